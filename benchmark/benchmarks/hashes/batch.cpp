@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+#include <es3n1n/common/hashes/fnv.hpp>
+#include <es3n1n/common/hashes/murmur.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+    /// \brief Identifier-like keys of 8-23 characters
+    std::vector<std::string> make_identifiers() {
+        std::vector<std::string> result;
+        for (std::size_t i = 0; i < 4096; ++i) {
+            result.emplace_back(8 + i % 16, static_cast<char>('a' + i % 26));
+        }
+        return result;
+    }
+
+    template <typename Hash>
+    void bm_hash_one_by_one(benchmark::State& state) {
+        const auto keys = make_identifiers();
+        const std::vector<std::string_view> views(keys.begin(), keys.end());
+        std::vector<decltype(Hash::hash(views.front()))> out(views.size());
+
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < views.size(); ++i) {
+                out[i] = Hash::hash(views[i]);
+            }
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * views.size()));
+    }
+    BENCHMARK(bm_hash_one_by_one<hashes::Fnv1a_64>);
+    BENCHMARK(bm_hash_one_by_one<hashes::Murmur3_32>);
+
+    template <typename Hash>
+    void bm_hash_many(benchmark::State& state) {
+        const auto keys = make_identifiers();
+        const std::vector<std::string_view> views(keys.begin(), keys.end());
+        std::vector<decltype(Hash::hash(views.front()))> out(views.size());
+
+        for (auto _ : state) {
+            Hash::hash_many(views, out);
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * views.size()));
+    }
+    BENCHMARK(bm_hash_many<hashes::Fnv1a_64>);
+    BENCHMARK(bm_hash_many<hashes::Murmur3_32>);
+} // namespace
@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+#include <es3n1n/common/hashes/bloom_filter.hpp>
+#include <memory>
+#include <vector>
+
+namespace {
+    constexpr std::size_t kKeys = 1 << 20;
+
+    /// A filter that is larger than the caches, so that every query is a cache miss
+    const hashes::BloomFilter<>& filter() {
+        static const auto result = []() -> hashes::BloomFilter<> {
+            auto filter = hashes::BloomFilter<>::with_capacity(kKeys * 16, 0.01);
+            for (std::uint64_t i = 0; i < kKeys * 16; i += 2) {
+                filter.insert_hash(hashes::Murmur3_64::hash_object(i));
+            }
+            return filter;
+        }();
+        return result;
+    }
+
+    std::vector<std::uint64_t> make_queries() {
+        std::vector<std::uint64_t> result(kKeys);
+        for (std::uint64_t i = 0; i < result.size(); ++i) {
+            result[i] = hashes::Murmur3_64::hash_object(i * 7);
+        }
+        return result;
+    }
+
+    void bm_bloom_contains(benchmark::State& state) {
+        const auto& bloom = filter();
+        const auto queries = make_queries();
+
+        for (auto _ : state) {
+            std::size_t found = 0;
+            for (const auto hash : queries) {
+                found += bloom.contains_hash(hash) ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(found);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * queries.size()));
+    }
+    BENCHMARK(bm_bloom_contains);
+
+    void bm_bloom_contains_batch(benchmark::State& state) {
+        const auto& bloom = filter();
+        const auto queries = make_queries();
+        const auto out = std::make_unique<bool[]>(queries.size());
+
+        for (auto _ : state) {
+            bloom.contains_hashes(queries, std::span(out.get(), queries.size()));
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * queries.size()));
+    }
+    BENCHMARK(bm_bloom_contains_batch);
+} // namespace
@@ -0,0 +1,40 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <es3n1n/common/hashes/case_insensitive.hpp>
+#include <string>
+
+namespace {
+    std::string make_input(const std::size_t size) {
+        std::string result(size, '\0');
+        for (std::size_t i = 0; i < size; ++i) {
+            result[i] = static_cast<char>((i % 3 == 0 ? 'A' : 'a') + i % 26);
+        }
+        return result;
+    }
+
+    template <typename Hash>
+    void bm_lowercase_copy(benchmark::State& state) {
+        const auto input = make_input(static_cast<std::size_t>(state.range(0)));
+
+        for (auto _ : state) {
+            std::string lower(input);
+            std::ranges::transform(lower, lower.begin(), [](const char c) { return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c; });
+            benchmark::DoNotOptimize(Hash::hash(lower));
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * input.size()));
+    }
+    BENCHMARK(bm_lowercase_copy<hashes::Fnv1a_32>)->RangeMultiplier(8)->Range(8, 1 << 15);
+    BENCHMARK(bm_lowercase_copy<hashes::Murmur3_32>)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+    template <typename Hash>
+    void bm_case_insensitive(benchmark::State& state) {
+        const auto input = make_input(static_cast<std::size_t>(state.range(0)));
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Hash::hash(input));
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * input.size()));
+    }
+    BENCHMARK(bm_case_insensitive<hashes::Fnv1a_32_ci>)->RangeMultiplier(8)->Range(8, 1 << 15);
+    BENCHMARK(bm_case_insensitive<hashes::Murmur3_32_ci>)->RangeMultiplier(8)->Range(8, 1 << 15);
+} // namespace
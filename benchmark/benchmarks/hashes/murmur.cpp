@@ -0,0 +1,22 @@
+#include <benchmark/benchmark.h>
+#include <es3n1n/common/hashes/murmur.hpp>
+#include <vector>
+
+namespace {
+    /// \note Wide strings are always hashed by the portable bytewise loop, so comparing the same amount of bytes
+    ///     viewed as char/wchar_t shows the gain of the word-at-a-time loads
+    template <typename Hash, typename CharTy>
+    void bm_murmur3(benchmark::State& state) {
+        const auto size = static_cast<std::size_t>(state.range(0));
+        const std::vector<CharTy> input(size / sizeof(CharTy), static_cast<CharTy>('a'));
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Hash::hash(std::span(input)));
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * size));
+    }
+    BENCHMARK(bm_murmur3<hashes::Murmur3_32, char>)->Range(64, 1 << 20);
+    BENCHMARK(bm_murmur3<hashes::Murmur3_32, wchar_t>)->Range(64, 1 << 20);
+    BENCHMARK(bm_murmur3<hashes::Murmur3_128, char>)->Range(64, 1 << 20);
+    BENCHMARK(bm_murmur3<hashes::Murmur3_128, wchar_t>)->Range(64, 1 << 20);
+} // namespace
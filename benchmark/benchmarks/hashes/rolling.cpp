@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+#include <es3n1n/common/hashes/fnv.hpp>
+#include <es3n1n/common/hashes/rolling.hpp>
+#include <vector>
+
+namespace {
+    constexpr std::size_t kDataSize = 1 << 20;
+
+    std::vector<std::uint8_t> make_input() {
+        std::vector<std::uint8_t> result(kDataSize);
+        for (std::size_t i = 0; i < result.size(); ++i) {
+            result[i] = static_cast<std::uint8_t>(i * 31 + (i >> 7));
+        }
+        return result;
+    }
+
+    template <typename Hash>
+    void bm_rolling_windows(benchmark::State& state) {
+        const auto input = make_input();
+        const Hash hash(static_cast<std::size_t>(state.range(0)));
+        std::vector<std::uint64_t> out(input.size());
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(hash.hash_windows(std::span(input), std::span(out)));
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * input.size()));
+    }
+    BENCHMARK(bm_rolling_windows<hashes::RabinKarp<>>)->Arg(16)->Arg(64)->Arg(256);
+    BENCHMARK(bm_rolling_windows<hashes::Buzhash<>>)->Arg(16)->Arg(64)->Arg(256);
+
+    /// Rehashing every window from scratch, O(n * window)
+    void bm_rehash_windows(benchmark::State& state) {
+        const auto input = make_input();
+        const auto window = static_cast<std::size_t>(state.range(0));
+        std::vector<std::uint64_t> out(input.size());
+
+        for (auto _ : state) {
+            for (std::size_t i = 0; i + window <= input.size(); ++i) {
+                out[i] = hashes::Fnv1a_64::hash(std::span(input).subspan(i, window));
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * input.size()));
+    }
+    BENCHMARK(bm_rehash_windows)->Arg(16)->Arg(64)->Arg(256);
+} // namespace
@@ -0,0 +1,34 @@
+#include <benchmark/benchmark.h>
+#include <es3n1n/common/hashes/fnv.hpp>
+#include <es3n1n/common/hashes/siphash.hpp>
+#include <es3n1n/common/hashes/xxhash.hpp>
+#include <vector>
+
+namespace {
+    template <typename Hash>
+    void bm_keyed(benchmark::State& state) {
+        const auto size = static_cast<std::size_t>(state.range(0));
+        const std::vector<char> input(size, 'a');
+        const Hash hash;
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(hash.hash(std::span(input)));
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * size));
+    }
+    BENCHMARK(bm_keyed<hashes::SipHash13>)->RangeMultiplier(4)->Range(8, 1 << 16);
+    BENCHMARK(bm_keyed<hashes::SipHash24>)->RangeMultiplier(4)->Range(8, 1 << 16);
+
+    template <typename Hash>
+    void bm_unkeyed(benchmark::State& state) {
+        const auto size = static_cast<std::size_t>(state.range(0));
+        const std::vector<char> input(size, 'a');
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Hash::hash(std::span(input)));
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * size));
+    }
+    BENCHMARK(bm_unkeyed<hashes::Fnv1a_64>)->RangeMultiplier(4)->Range(8, 1 << 16);
+    BENCHMARK(bm_unkeyed<hashes::Xxh3_64>)->RangeMultiplier(4)->Range(8, 1 << 16);
+} // namespace
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+#include <es3n1n/common/hashes/fnv.hpp>
+#include <es3n1n/common/hashes/static_map.hpp>
+#include <es3n1n/common/hashes/xxhash.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    constexpr std::array<std::string_view, 48> kKeywordList = {
+        "alignas", "alignof", "auto",     "bool",      "break",  "case",     "catch",    "char",     "class",   "const",  "consteval", "constexpr",
+        "default", "delete",  "do",       "double",    "else",   "enum",     "explicit", "extern",   "false",   "float",  "for",       "friend",
+        "goto",    "if",      "inline",   "int",       "long",   "mutable",  "namespace", "new",     "noexcept", "nullptr", "operator", "private",
+        "public",  "return",  "sizeof",   "static",    "struct", "switch",   "template", "this",     "throw",   "true",   "typename",  "using",
+    };
+
+    template <typename Hash>
+    constexpr auto kKeywords = hashes::StaticMap<Hash, std::size_t, kKeywordList.size()>([]() {
+        std::array<std::pair<std::string_view, std::size_t>, kKeywordList.size()> result = {};
+        for (std::size_t i = 0; i < kKeywordList.size(); ++i) {
+            result[i] = {kKeywordList[i], i};
+        }
+        return result;
+    }());
+
+    /// \brief Half of the queries are keywords, the other half are identifiers
+    std::vector<std::string> make_queries() {
+        std::vector<std::string> result;
+        for (std::size_t i = 0; i < 1024; ++i) {
+            result.emplace_back(i % 2 == 0 ? std::string(kKeywordList[i / 2 % kKeywordList.size()]) : "identifier_" + std::to_string(i));
+        }
+        return result;
+    }
+
+    template <typename Hash>
+    void bm_static_map(benchmark::State& state) {
+        const auto queries = make_queries();
+        for (auto _ : state) {
+            for (const auto& query : queries) {
+                benchmark::DoNotOptimize(kKeywords<Hash>.find(query));
+            }
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * queries.size()));
+    }
+    BENCHMARK(bm_static_map<hashes::Fnv1a_32>);
+    BENCHMARK(bm_static_map<hashes::Xxh3_64>);
+
+    void bm_unordered_map(benchmark::State& state) {
+        const auto queries = make_queries();
+        std::unordered_map<std::string_view, std::size_t> keywords;
+        for (std::size_t i = 0; i < kKeywordList.size(); ++i) {
+            keywords.emplace(kKeywordList[i], i);
+        }
+
+        for (auto _ : state) {
+            for (const auto& query : queries) {
+                benchmark::DoNotOptimize(keywords.find(query));
+            }
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * queries.size()));
+    }
+    BENCHMARK(bm_unordered_map);
+} // namespace
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+#include <es3n1n/common/hashes/crc.hpp>
+#include <es3n1n/common/hashes/fnv.hpp>
+#include <es3n1n/common/hashes/murmur.hpp>
+#include <es3n1n/common/hashes/xxhash.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr std::int64_t kMinSize = 8;
+    constexpr std::int64_t kMaxSize = 16 << 20;
+    constexpr int kSizeMultiplier = 8;
+
+    /// \brief Input of the requested size in bytes, null terminated and without any zero characters inside
+    template <typename CharTy>
+    std::basic_string<CharTy> make_input(const benchmark::State& state) {
+        const auto size = static_cast<std::size_t>(state.range(0)) / sizeof(CharTy);
+
+        std::basic_string<CharTy> result(size, CharTy{});
+        for (std::size_t i = 0; i < size; ++i) {
+            result[i] = static_cast<CharTy>('a' + i % 26);
+        }
+        return result;
+    }
+
+    template <typename CharTy>
+    void set_bytes_processed(benchmark::State& state, const std::basic_string<CharTy>& input) {
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * input.size() * sizeof(CharTy)));
+    }
+
+    template <typename Hash, typename CharTy>
+    void bm_hash_span(benchmark::State& state) {
+        const auto input = make_input<CharTy>(state);
+        const auto data = std::span(input.data(), input.size());
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Hash::hash(data));
+        }
+        set_bytes_processed(state, input);
+    }
+
+    /// \note Includes the length computation of the null terminated string
+    template <typename Hash, typename CharTy>
+    void bm_hash_pointer(benchmark::State& state) {
+        const auto input = make_input<CharTy>(state);
+        const CharTy* data = input.c_str();
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(data);
+            benchmark::DoNotOptimize(Hash::hash(data));
+        }
+        set_bytes_processed(state, input);
+    }
+
+    template <typename Hash, typename CharTy>
+    void bm_hash_string(benchmark::State& state) {
+        const auto input = make_input<CharTy>(state);
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Hash::hash(input));
+        }
+        set_bytes_processed(state, input);
+    }
+
+/// Every hash is measured over spans of all the character types, null terminated strings and std::string
+#define HASH_BENCHMARKS(...)                                                                                           \
+    BENCHMARK(bm_hash_span<__VA_ARGS__, char>)->RangeMultiplier(kSizeMultiplier)->Range(kMinSize, kMaxSize);          \
+    BENCHMARK(bm_hash_span<__VA_ARGS__, std::uint8_t>)->RangeMultiplier(kSizeMultiplier)->Range(kMinSize, kMaxSize);  \
+    BENCHMARK(bm_hash_span<__VA_ARGS__, wchar_t>)->RangeMultiplier(kSizeMultiplier)->Range(kMinSize, kMaxSize);       \
+    BENCHMARK(bm_hash_pointer<__VA_ARGS__, char>)->RangeMultiplier(kSizeMultiplier)->Range(kMinSize, kMaxSize);       \
+    BENCHMARK(bm_hash_pointer<__VA_ARGS__, wchar_t>)->RangeMultiplier(kSizeMultiplier)->Range(kMinSize, kMaxSize);    \
+    BENCHMARK(bm_hash_string<__VA_ARGS__, char>)->RangeMultiplier(kSizeMultiplier)->Range(kMinSize, kMaxSize);        \
+    BENCHMARK(bm_hash_string<__VA_ARGS__, wchar_t>)->RangeMultiplier(kSizeMultiplier)->Range(kMinSize, kMaxSize)
+
+    HASH_BENCHMARKS(hashes::Fnv1_32);
+    HASH_BENCHMARKS(hashes::Fnv1_64);
+    HASH_BENCHMARKS(hashes::Fnv1a_32);
+    HASH_BENCHMARKS(hashes::Fnv1a_64);
+    HASH_BENCHMARKS(hashes::Crcb_32);
+    HASH_BENCHMARKS(hashes::Crc32c);
+    HASH_BENCHMARKS(hashes::Crc16_ccitt);
+    HASH_BENCHMARKS(hashes::Crc64_ecma);
+    HASH_BENCHMARKS(hashes::Crc64_xz);
+    HASH_BENCHMARKS(hashes::Murmur3_32);
+    HASH_BENCHMARKS(hashes::Murmur3_128);
+    HASH_BENCHMARKS(hashes::Xxh3_64);
+
+#undef HASH_BENCHMARKS
+} // namespace
@@ -0,0 +1,19 @@
+#include <benchmark/benchmark.h>
+#include <es3n1n/common/hashes/murmur.hpp>
+#include <es3n1n/common/hashes/xxhash.hpp>
+#include <vector>
+
+namespace {
+    template <typename Hash>
+    void bm_long_keys(benchmark::State& state) {
+        const auto size = static_cast<std::size_t>(state.range(0));
+        const std::vector<char> input(size, 'a');
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Hash::hash(std::span(input)));
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * size));
+    }
+    BENCHMARK(bm_long_keys<hashes::Xxh3_64>)->Range(16, 1 << 20);
+    BENCHMARK(bm_long_keys<hashes::Murmur3_64>)->Range(16, 1 << 20);
+} // namespace
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+#include <es3n1n/common/memory/address.hpp>
+#include <es3n1n/common/memory/page_cache.hpp>
+#include <es3n1n/common/memory/process.hpp>
+#include <cstddef>
+#include <vector>
+
+#if PLATFORM_IS_LINUX
+    #include <unistd.h>
+
+namespace {
+    constexpr std::size_t kNodes = 256;
+    constexpr std::size_t kWalks = 64;
+
+    struct Node {
+        std::uintptr_t next = 0;
+        std::uint64_t value = 0;
+    };
+
+    /// Nodes linked in a scattered order, so that a walk jumps between the pages
+    const std::vector<Node>& nodes() {
+        static const auto result = []() -> std::vector<Node> {
+            std::vector<Node> nodes(kNodes);
+            for (std::size_t i = 0; i < kNodes; ++i) {
+                const auto next = (i * 97 + 1) % kNodes;
+                nodes[i] = {.next = reinterpret_cast<std::uintptr_t>(&nodes[next]), .value = i};
+            }
+            return nodes;
+        }();
+        return result;
+    }
+
+    /// Follow the chain from a few starting nodes, every hop is a read of the remote process
+    std::uint64_t walk() {
+        std::uint64_t sum = 0;
+        for (std::size_t start = 0; start < kWalks; ++start) {
+            memory::Address node = &nodes()[start];
+            for (std::size_t depth = 0; depth < 8; ++depth) {
+                sum += node.offset(offsetof(Node, value)).read<std::uint64_t>().value_or(0);
+                node = node.deref().value_or(memory::Address{});
+            }
+        }
+        return sum;
+    }
+
+    void bm_pointer_chain_uncached(benchmark::State& state) {
+        memory::process::attach(getpid());
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(walk());
+        }
+        memory::process::detach();
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kWalks * 8));
+    }
+    BENCHMARK(bm_pointer_chain_uncached);
+
+    void bm_pointer_chain_cached(benchmark::State& state) {
+        memory::process::attach(getpid());
+        memory::enable_page_cache();
+        for (auto _ : state) {
+            // Every iteration is a new frame, the pages are refetched
+            memory::page_cache().invalidate();
+            benchmark::DoNotOptimize(walk());
+        }
+        memory::disable_page_cache();
+        memory::process::detach();
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kWalks * 8));
+    }
+    BENCHMARK(bm_pointer_chain_cached);
+} // namespace
+#endif
@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+#include <es3n1n/common/memory/scanner.hpp>
+#include <random>
+#include <vector>
+
+namespace {
+    constexpr std::size_t kSize = 16 * 1024 * 1024;
+    constexpr auto kSignature = "48 8B 05 ?? ?? ?? ?? 48 85 C0 74 ?? E8";
+
+    /// Bytes that are mostly common x86 opcodes, with the signature at the very end
+    const std::vector<std::uint8_t>& image() {
+        static const auto result = []() -> std::vector<std::uint8_t> {
+            constexpr std::array<std::uint8_t, 16> kCommon = {0x00, 0x48, 0x8B, 0x89, 0xE8, 0xFF, 0xCC, 0x0F, 0x24, 0x4C, 0x85, 0xC0, 0x74, 0x05, 0x41, 0x90};
+            std::mt19937 rng(1337);
+            std::vector<std::uint8_t> image(kSize);
+            for (auto& byte : image) {
+                byte = rng() % 4 == 0 ? static_cast<std::uint8_t>(rng()) : kCommon[rng() % kCommon.size()];
+            }
+            const std::array<std::uint8_t, 13> signature = {0x48, 0x8B, 0x05, 0x11, 0x22, 0x33, 0x44, 0x48, 0x85, 0xC0, 0x74, 0x10, 0xE8};
+            std::ranges::copy(signature, image.end() - signature.size());
+            return image;
+        }();
+        return result;
+    }
+
+    void bm_scan_naive(benchmark::State& state) {
+        const auto& data = image();
+        const memory::Pattern pattern(kSignature);
+        const auto view = pattern.view();
+
+        for (auto _ : state) {
+            std::size_t result = 0;
+            for (std::size_t i = 0; i + view.size() <= data.size(); ++i) {
+                if (view.matches(data.data() + i)) {
+                    result = i;
+                    break;
+                }
+            }
+            benchmark::DoNotOptimize(result);
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * data.size()));
+    }
+    BENCHMARK(bm_scan_naive);
+
+    void bm_scan(benchmark::State& state) {
+        const auto& data = image();
+        const memory::Pattern pattern(kSignature);
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(memory::scan_first(data, pattern));
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * data.size()));
+    }
+    BENCHMARK(bm_scan);
+} // namespace
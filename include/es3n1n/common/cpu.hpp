@@ -0,0 +1,88 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "platform.hpp"
+
+#if PLATFORM_IS_X86
+    #if PLATFORM_IS_MSVC
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#endif
+
+namespace cpu {
+    /// \brief Instruction set extensions that are used by the runtime-dispatched code paths
+    struct Features {
+        bool sse2 = false;
+        bool ssse3 = false;
+        bool sse41 = false;
+        bool sse42 = false;
+        bool pclmul = false;
+        bool avx2 = false;
+    };
+
+    namespace detail {
+#if PLATFORM_IS_X86
+        /// \brief Executes cpuid, returns {eax, ebx, ecx, edx}
+        inline std::array<std::uint32_t, 4> cpuid(const std::uint32_t leaf, const std::uint32_t subleaf = 0) noexcept {
+            std::array<std::uint32_t, 4> regs = {};
+    #if PLATFORM_IS_MSVC
+            std::array<int, 4> raw = {};
+            __cpuidex(raw.data(), static_cast<int>(leaf), static_cast<int>(subleaf));
+            for (std::size_t i = 0; i < raw.size(); ++i) {
+                regs.at(i) = static_cast<std::uint32_t>(raw.at(i));
+            }
+    #else
+            __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+    #endif
+            return regs;
+        }
+
+        /// \brief Reads the XCR0 register, this tells us whether the OS saves the AVX state on context switches
+        inline std::uint64_t xcr0() noexcept {
+    #if PLATFORM_IS_MSVC
+            return _xgetbv(0);
+    #else
+            std::uint32_t eax = 0;
+            std::uint32_t edx = 0;
+            __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+            return (static_cast<std::uint64_t>(edx) << 32U) | eax;
+    #endif
+        }
+#endif
+
+        [[nodiscard]] inline Features detect() noexcept {
+            Features result = {};
+#if PLATFORM_IS_X86
+            const auto max_leaf = cpuid(0)[0];
+            if (max_leaf < 1) {
+                return result;
+            }
+
+            const auto leaf1 = cpuid(1);
+            result.sse2 = (leaf1[3] & (1U << 26U)) != 0;
+            result.ssse3 = (leaf1[2] & (1U << 9U)) != 0;
+            result.sse41 = (leaf1[2] & (1U << 19U)) != 0;
+            result.sse42 = (leaf1[2] & (1U << 20U)) != 0;
+            result.pclmul = (leaf1[2] & (1U << 1U)) != 0;
+
+            const bool osxsave = (leaf1[2] & (1U << 27U)) != 0;
+            const bool avx = (leaf1[2] & (1U << 28U)) != 0;
+            if (max_leaf >= 7 && osxsave && avx && (xcr0() & 0b110U) == 0b110U) {
+                result.avx2 = (cpuid(7)[1] & (1U << 5U)) != 0;
+            }
+#endif
+            return result;
+        }
+    } // namespace detail
+
+    /// \brief Get the features supported by the current CPU
+    /// \note Detection is performed only once, on the first call
+    [[nodiscard]] inline const Features& features() noexcept {
+        static const Features result = detail::detect();
+        return result;
+    }
+} // namespace cpu
@@ -1,17 +1,130 @@
 #pragma once
+#include <array>
+#include <bit>
+#include <cassert>
+#include <climits>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <memory>
 #include <optional>
+#include <ranges>
 #include <span>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
+#include "es3n1n/common/numeric.hpp"
 #include "es3n1n/common/traits.hpp"
 
 namespace hashes {
+    /// \brief A 128-bit hash value
+    struct Hash128 {
+        std::uint64_t low = 0;
+        std::uint64_t high = 0;
+
+        constexpr bool operator==(const Hash128& other) const noexcept = default;
+    };
+
     namespace detail {
-        template <typename Ty> concept HashSize = traits::is_any_of_v<Ty, std::size_t, std::uint32_t, std::uint64_t>;
-        template <typename Ty> concept Hashable = traits::is_any_of_v<std::remove_cv_t<Ty>, std::uint8_t, char, wchar_t>;
+        template <typename Ty> concept HashSize = traits::is_any_of_v<Ty, std::size_t, std::uint16_t, std::uint32_t, std::uint64_t, Hash128>;
+        template <typename Ty> concept Hashable =
+            traits::is_any_of_v<std::remove_cv_t<Ty>, std::uint8_t, std::byte, char, wchar_t, char8_t, char16_t, char32_t>;
         using DefaultHashSize = std::uint32_t;
+
+        /// \brief Contiguous range of characters, hashed just like a span of them
+        /// \note Arrays are excluded, so that string literals are still hashed without their null terminator
+        template <typename Ty> concept HashableRange = std::ranges::contiguous_range<Ty> && std::ranges::sized_range<Ty> &&
+                                                       !std::is_array_v<std::remove_cvref_t<Ty>> && Hashable<std::ranges::range_value_t<Ty>>;
+
+        /// \brief Contiguous range of objects, hashed as the sequence of their bytes
+        template <typename Ty> concept HashableObjectRange =
+            std::ranges::contiguous_range<Ty> && std::ranges::sized_range<Ty> && traits::TriviallyCopyable<std::ranges::range_value_t<Ty>>;
+
+        /// \brief Length of the null terminated string
+        template <Hashable CharTy>
+        [[nodiscard]] constexpr std::size_t string_length(const CharTy* value) noexcept {
+            if constexpr (traits::is_any_of_v<std::remove_cv_t<CharTy>, char, wchar_t, char8_t, char16_t, char32_t>) {
+                return std::char_traits<std::remove_cv_t<CharTy>>::length(value);
+            } else {
+                std::size_t result = 0;
+                while (value[result] != CharTy{}) {
+                    ++result;
+                }
+                return result;
+            }
+        }
+
+        /// \brief Invoke the callback with the bytes of the object
+        /// \note Objects are reinterpreted in place at runtime, constant evaluation has to copy them with bit_cast
+        template <traits::TriviallyCopyable ObjTy, typename Fn>
+        constexpr decltype(auto) with_object_bytes(const ObjTy& value, Fn&& fn) noexcept {
+            if (std::is_constant_evaluated()) {
+                const auto bytes = std::bit_cast<std::array<std::uint8_t, sizeof(ObjTy)>>(value);
+                return fn(std::span<const std::uint8_t>(bytes));
+            }
+            return fn(std::span(reinterpret_cast<const std::uint8_t*>(std::addressof(value)), sizeof(ObjTy)));
+        }
+
+        /// \brief Amount of keys that are hashed in lockstep by the batched implementations
+        inline constexpr std::size_t kBatchLanes = 8;
+
+        /// \brief Invoke the callback for every lane of the batch, the lane index is passed as a compile-time constant
+        /// \note Lanes are expanded with a fold expression so that the states of all of them can be kept in registers
+        template <typename Fn>
+        constexpr void for_each_lane(Fn&& fn) noexcept {
+            [&]<std::size_t... Lanes>(std::index_sequence<Lanes...>) {
+                (fn(std::integral_constant<std::size_t, Lanes>{}), ...);
+            }(std::make_index_sequence<kBatchLanes>{});
+        }
+
+        /// \brief Length of the shortest key in the group, every lane can be advanced this far without any checks
+        template <Hashable CharTy>
+        [[nodiscard]] constexpr std::size_t common_size(const std::span<const std::basic_string_view<CharTy>> group) noexcept {
+            std::size_t result = group.front().size();
+            for (const auto& value : group.subspan(1)) {
+                result = value.size() < result ? value.size() : result;
+            }
+            return result;
+        }
+
+        /// \brief Get the byte at the specified byte offset of the character sequence
+        template <Hashable CharTy>
+        [[nodiscard]] constexpr std::uint8_t read_byte(const std::span<CharTy>& value, const std::size_t offset) noexcept {
+            const std::size_t char_index = offset / sizeof(CharTy);
+            const std::size_t byte_index = offset % sizeof(CharTy);
+
+            const auto char_val = std::bit_cast<std::make_unsigned_t<CharTy>>(value[char_index]);
+            const auto shift_count = byte_index * CHAR_BIT;
+            return static_cast<std::uint8_t>((char_val >> shift_count) & 0xFFU);
+        }
+
+        /// \brief Unaligned little-endian load of a whole block at the specified byte offset
+        /// \note Not usable in constant evaluation, use read_byte there
+        template <std::integral Ty, Hashable CharTy>
+            requires(sizeof(CharTy) == 1)
+        [[nodiscard]] Ty load_le(const std::span<CharTy>& value, const std::size_t offset) noexcept {
+            Ty result = 0;
+            std::memcpy(&result, value.data() + offset, sizeof(Ty));
+            return numeric::to_le(result);
+        }
+
+        /// \brief Little-endian read of an integer at the specified byte offset of the character sequence
+        template <std::integral Ty, Hashable CharTy>
+        [[nodiscard]] constexpr Ty read_le(const std::span<CharTy>& value, const std::size_t offset) noexcept {
+            if constexpr (sizeof(CharTy) == 1) {
+                if (!std::is_constant_evaluated()) {
+                    return load_le<Ty>(value, offset);
+                }
+            }
+
+            Ty result = 0;
+            for (std::size_t i = 0; i < sizeof(Ty); ++i) {
+                result |= static_cast<Ty>(read_byte(value, offset + i)) << (i * CHAR_BIT);
+            }
+            return result;
+        }
     } // namespace detail
 
     /// \brief Base class for hash functions using CRTP
@@ -45,6 +158,60 @@ namespace hashes {
             Ty value_;
         };
 
+        /// \brief Incremental hasher, feeding the data in chunks gives the same result as hashing it in one shot
+        /// \note The state is trivially copyable, so a partially hashed prefix can be forked by copying the hasher
+        class Hasher {
+        public:
+            constexpr Hasher() noexcept: state_(Derived::init()) { }
+
+            constexpr Hasher& init() noexcept {
+                state_ = Derived::init();
+                return *this;
+            }
+
+            template <detail::Hashable CharTy>
+            constexpr Hasher& update(const std::span<CharTy> value) noexcept {
+                Derived::update(state_, value);
+                return *this;
+            }
+
+            template <detail::Hashable CharTy>
+            constexpr Hasher& update(const CharTy* value, std::optional<std::size_t> size = std::nullopt) noexcept {
+                if (!size.has_value()) {
+                    size = detail::string_length(value);
+                }
+                return update(std::span(value, *size));
+            }
+
+            template <detail::HashableRange Range>
+            constexpr Hasher& update(const Range& value) noexcept {
+                return update(std::span(std::ranges::data(value), std::ranges::size(value)));
+            }
+
+            /// \brief Feed the bytes of the object
+            template <traits::TriviallyCopyable ObjTy>
+            constexpr Hasher& update_object(const ObjTy& value) noexcept {
+                return detail::with_object_bytes(value, [this](const auto bytes) -> Hasher& { return update(bytes); });
+            }
+
+            template <detail::Hashable CharTy>
+            constexpr Hasher& update(const std::basic_string<CharTy>& value) noexcept {
+                return update(std::span(value.data(), value.size()));
+            }
+
+            template <detail::Hashable CharTy>
+            constexpr Hasher& update(const std::basic_string_view<CharTy>& value) noexcept {
+                return update(std::span(value.data(), value.size()));
+            }
+
+            [[nodiscard]] constexpr Ty finalize() const noexcept {
+                return Derived::finalize(state_);
+            }
+
+        private:
+            typename Derived::State state_;
+        };
+
         template <detail::Hashable CharTy>
         [[nodiscard]] static constexpr Ty hash(const std::span<CharTy> value) noexcept {
             return Derived::hash_impl(value);
@@ -58,7 +225,7 @@ namespace hashes {
         template <detail::Hashable CharTy>
         [[nodiscard]] static constexpr Ty hash(const CharTy* value, std::optional<std::size_t> size = std::nullopt) noexcept {
             if (!size.has_value()) {
-                size = std::char_traits<CharTy>::length(value);
+                size = detail::string_length(value);
             }
             return hash(std::span(value, *size));
         }
@@ -87,5 +254,118 @@ namespace hashes {
         [[nodiscard]] constexpr Ty operator()(const std::basic_string_view<CharTy>& value) const noexcept {
             return hash(value);
         }
+
+        /// \brief Hash the characters of a contiguous range, e.g. std::vector<std::byte> or std::array<char8_t, N>
+        template <detail::HashableRange Range>
+        [[nodiscard]] static constexpr Ty hash(const Range& value) noexcept {
+            return hash(std::span(std::ranges::data(value), std::ranges::size(value)));
+        }
+
+        template <detail::HashableRange Range>
+        [[nodiscard]] constexpr Ty operator()(const Range& value) const noexcept {
+            return hash(value);
+        }
+
+        /// \brief Hash the bytes of a trivially copyable object
+        /// \note Padding bytes are hashed too, objects with padding should be zero-initialized
+        template <traits::TriviallyCopyable ObjTy>
+        [[nodiscard]] static constexpr Ty hash_object(const ObjTy& value) noexcept {
+            return detail::with_object_bytes(value, [](const auto bytes) -> Ty { return hash(bytes); });
+        }
+
+        /// \brief Hash the bytes of every object of a contiguous range, as if they were a single buffer
+        template <detail::HashableObjectRange Range>
+        [[nodiscard]] static constexpr Ty hash_objects(const Range& values) noexcept {
+            using ObjTy = std::ranges::range_value_t<Range>;
+            if (std::is_constant_evaluated()) {
+                std::vector<std::uint8_t> bytes;
+                for (const auto& value : values) {
+                    const auto value_bytes = std::bit_cast<std::array<std::uint8_t, sizeof(ObjTy)>>(value);
+                    bytes.insert(bytes.end(), value_bytes.begin(), value_bytes.end());
+                }
+                return hash(std::span<const std::uint8_t>(bytes));
+            }
+            return hash(std::span(reinterpret_cast<const std::uint8_t*>(std::ranges::data(values)), std::ranges::size(values) * sizeof(ObjTy)));
+        }
+
+        /// \brief Hash a batch of keys, `out[i]` is set to `hash(values[i])`
+        /// \note Derived classes can provide `hash_many_impl` that hashes multiple keys at once, otherwise they're hashed one by one
+        template <detail::Hashable CharTy>
+        static constexpr void hash_many(const std::span<const std::basic_string_view<CharTy>> values, const std::span<Ty> out) noexcept {
+            assert(out.size() >= values.size());
+            if constexpr (requires { Derived::hash_many_impl(values, out); }) {
+                Derived::hash_many_impl(values, out);
+            } else {
+                for (std::size_t i = 0; i < values.size(); ++i) {
+                    out[i] = hash(values[i]);
+                }
+            }
+        }
+
+        static constexpr void hash_many(const std::span<const std::string_view> values, const std::span<Ty> out) noexcept {
+            hash_many<char>(values, out);
+        }
+    };
+
+    /// \brief Base class for hash functions that are keyed at runtime using CRTP
+    /// \tparam Derived The derived hash function class, it should provide a const member `hash_impl`
+    /// \tparam Ty The size type for the hash
+    /// \note Unlike HashFunction, hashes are computed by an instance, because the result depends on its key
+    template <typename Derived, detail::HashSize Ty = detail::DefaultHashSize>
+    class KeyedHashFunction {
+    public:
+        template <detail::Hashable CharTy>
+        [[nodiscard]] constexpr Ty hash(const std::span<CharTy> value) const noexcept {
+            return static_cast<const Derived&>(*this).hash_impl(value);
+        }
+
+        template <detail::Hashable CharTy>
+        [[nodiscard]] constexpr Ty hash(const CharTy* value, std::optional<std::size_t> size = std::nullopt) const noexcept {
+            if (!size.has_value()) {
+                size = detail::string_length(value);
+            }
+            return hash(std::span(value, *size));
+        }
+
+        template <detail::Hashable CharTy>
+        [[nodiscard]] constexpr Ty hash(const std::basic_string<CharTy>& value) const noexcept {
+            return hash(std::span(value.data(), value.size()));
+        }
+
+        template <detail::Hashable CharTy>
+        [[nodiscard]] constexpr Ty hash(const std::basic_string_view<CharTy>& value) const noexcept {
+            return hash(std::span(value.data(), value.size()));
+        }
+
+        template <detail::HashableRange Range>
+        [[nodiscard]] constexpr Ty hash(const Range& value) const noexcept {
+            return hash(std::span(std::ranges::data(value), std::ranges::size(value)));
+        }
+
+        /// \brief Hash the bytes of a trivially copyable object
+        /// \note Padding bytes are hashed too, objects with padding should be zero-initialized
+        template <traits::TriviallyCopyable ObjTy>
+        [[nodiscard]] constexpr Ty hash_object(const ObjTy& value) const noexcept {
+            return detail::with_object_bytes(value, [this](const auto bytes) -> Ty { return hash(bytes); });
+        }
+
+        template <typename ValueTy>
+            requires requires(const KeyedHashFunction& self, const ValueTy& value) { self.hash(value); }
+        [[nodiscard]] constexpr Ty operator()(const ValueTy& value) const noexcept {
+            return hash(value);
+        }
+
+        /// \brief Hash a batch of keys, `out[i]` is set to `hash(values[i])`
+        template <detail::Hashable CharTy>
+        constexpr void hash_many(const std::span<const std::basic_string_view<CharTy>> values, const std::span<Ty> out) const noexcept {
+            assert(out.size() >= values.size());
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                out[i] = hash(values[i]);
+            }
+        }
+
+        constexpr void hash_many(const std::span<const std::string_view> values, const std::span<Ty> out) const noexcept {
+            hash_many<char>(values, out);
+        }
     };
 } // namespace hashes
@@ -0,0 +1,269 @@
+#pragma once
+#include "es3n1n/common/hashes/base.hpp"
+#include "es3n1n/common/hashes/murmur.hpp"
+#include "es3n1n/common/numeric.hpp"
+#include "es3n1n/common/platform.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstring>
+#include <limits>
+#include <numbers>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace hashes {
+    /// \brief Bloom filter where all probes of a key hit a single cache line
+    /// \tparam Hash The 64-bit hash function, keys are hashed only once
+    /// \note The upper half of the hash picks the block, the probes inside it are derived from the hash with double hashing.
+    ///     Blocking makes every query a single cache miss, at the cost of a slightly higher false positive rate
+    /// \see https://www.cs.amherst.edu/~ccmcgeoch/cs34/papers/cacheefficientbloomfilters-jea.pdf
+    template <typename Hash = Murmur3_64>
+        requires std::same_as<decltype(Hash::hash(std::string_view{})), std::uint64_t>
+    class BloomFilter {
+    public:
+        static constexpr std::size_t kBlockSize = 64;
+        static constexpr std::size_t kBlockBits = kBlockSize * CHAR_BIT;
+        static constexpr std::uint32_t kMaxProbes = 16;
+        /// \brief Block indices are derived from 32 bits of the hash, the byte size should fit in `std::size_t` too
+        static constexpr std::size_t kMaxBlocks =
+            static_cast<std::size_t>(std::min<std::uint64_t>(std::uint64_t{1} << 32U, std::numeric_limits<std::size_t>::max() / kBlockSize));
+
+    private:
+        static constexpr std::size_t kWords = kBlockSize / sizeof(std::uint64_t);
+        static constexpr std::size_t kBatchSize = 16;
+        static constexpr std::uint32_t kMagic = 0x314D4C42; // "BLM1"
+        static constexpr std::size_t kHeaderSize = sizeof(std::uint32_t) * 2 + sizeof(std::uint64_t);
+
+        struct alignas(kBlockSize) Block {
+            std::array<std::uint64_t, kWords> words = {};
+        };
+
+    public:
+        /// \param blocks Amount of cache line sized blocks
+        /// \param probes Amount of bits set per key
+        /// \throws std::invalid_argument if any of the sizes is out of range
+        BloomFilter(const std::size_t blocks, const std::uint32_t probes): probes_(probes) {
+            if (blocks == 0 || blocks > kMaxBlocks) {
+                throw std::invalid_argument("BloomFilter: invalid amount of blocks");
+            }
+            if (probes == 0 || probes > kMaxProbes) {
+                throw std::invalid_argument("BloomFilter: invalid amount of probes");
+            }
+            blocks_.resize(blocks);
+        }
+
+        /// \brief Size the filter for the expected amount of keys and the false positive rate
+        /// \throws std::invalid_argument if the rate is not in (0, 1)
+        [[nodiscard]] static BloomFilter with_capacity(const std::size_t expected_keys, const double false_positive_rate) {
+            if (!(false_positive_rate > 0.0 && false_positive_rate < 1.0)) {
+                throw std::invalid_argument("BloomFilter: false positive rate should be in (0, 1)");
+            }
+
+            const auto keys = static_cast<double>(std::max<std::size_t>(expected_keys, 1));
+            const auto bits = -keys * std::log(false_positive_rate) / (std::numbers::ln2 * std::numbers::ln2);
+            const auto blocks = static_cast<std::size_t>(std::clamp(std::ceil(bits / kBlockBits), 1.0, static_cast<double>(kMaxBlocks)));
+            const auto probes = std::lround(static_cast<double>(blocks * kBlockBits) / keys * std::numbers::ln2);
+            return {blocks, static_cast<std::uint32_t>(std::clamp<long>(probes, 1, kMaxProbes))};
+        }
+
+        template <typename KeyTy>
+            requires requires(const KeyTy& key) { Hash::hash(key); }
+        void insert(const KeyTy& key) noexcept {
+            insert_hash(Hash::hash(key));
+        }
+
+        template <typename KeyTy>
+            requires requires(const KeyTy& key) { Hash::hash(key); }
+        [[nodiscard]] bool contains(const KeyTy& key) const noexcept {
+            return contains_hash(Hash::hash(key));
+        }
+
+        /// \brief Insert the bytes of a trivially copyable object, e.g. an address
+        template <traits::TriviallyCopyable ObjTy>
+        void insert_object(const ObjTy& value) noexcept {
+            insert_hash(Hash::hash_object(value));
+        }
+
+        template <traits::TriviallyCopyable ObjTy>
+        [[nodiscard]] bool contains_object(const ObjTy& value) const noexcept {
+            return contains_hash(Hash::hash_object(value));
+        }
+
+        /// \brief Insert a key by its hash, the hash should be computed with `Hash`
+        void insert_hash(const std::uint64_t hash) noexcept {
+            const auto mask = probe_mask(hash);
+            auto& block = blocks_[block_index(hash)];
+            for (std::size_t i = 0; i < kWords; ++i) {
+                block.words[i] |= mask[i];
+            }
+        }
+
+        [[nodiscard]] bool contains_hash(const std::uint64_t hash) const noexcept {
+            const auto mask = probe_mask(hash);
+            const auto& block = blocks_[block_index(hash)];
+
+            std::uint64_t missing = 0;
+            for (std::size_t i = 0; i < kWords; ++i) {
+                missing |= mask[i] & ~block.words[i];
+            }
+            return missing == 0;
+        }
+
+        /// \brief Insert a batch of hashes, the blocks of the whole group are prefetched before they are touched
+        void insert_hashes(const std::span<const std::uint64_t> hashes) noexcept {
+            for_each_group(hashes, [this](const std::uint64_t hash, std::size_t) -> void { insert_hash(hash); });
+        }
+
+        /// \brief Query a batch of hashes, `out[i]` is set to `contains_hash(hashes[i])`
+        void contains_hashes(const std::span<const std::uint64_t> hashes, const std::span<bool> out) const noexcept {
+            assert(out.size() >= hashes.size());
+            for_each_group(hashes, [this, out](const std::uint64_t hash, const std::size_t index) -> void { out[index] = contains_hash(hash); });
+        }
+
+        /// \brief Insert a batch of keys, they're hashed with `Hash::hash_many`
+        void insert_many(const std::span<const std::string_view> keys) noexcept {
+            std::array<std::uint64_t, kBatchSize> hashes = {};
+            for (std::size_t i = 0; i < keys.size(); i += kBatchSize) {
+                const auto group = keys.subspan(i, std::min(kBatchSize, keys.size() - i));
+                Hash::hash_many(group, std::span(hashes));
+                insert_hashes(std::span(hashes).first(group.size()));
+            }
+        }
+
+        /// \brief Query a batch of keys, `out[i]` is set to `contains(keys[i])`
+        void contains_many(const std::span<const std::string_view> keys, const std::span<bool> out) const noexcept {
+            assert(out.size() >= keys.size());
+            std::array<std::uint64_t, kBatchSize> hashes = {};
+            for (std::size_t i = 0; i < keys.size(); i += kBatchSize) {
+                const auto group = keys.subspan(i, std::min(kBatchSize, keys.size() - i));
+                Hash::hash_many(group, std::span(hashes));
+                contains_hashes(std::span(hashes).first(group.size()), out.subspan(i, group.size()));
+            }
+        }
+
+        /// \brief Add all keys of the other filter, e.g. to combine per-thread filters
+        /// \throws std::invalid_argument if the filters have different shapes
+        void merge(const BloomFilter& other) {
+            if (other.blocks_.size() != blocks_.size() || other.probes_ != probes_) {
+                throw std::invalid_argument("BloomFilter: unable to merge filters of different shapes");
+            }
+            for (std::size_t i = 0; i < blocks_.size(); ++i) {
+                for (std::size_t j = 0; j < kWords; ++j) {
+                    blocks_[i].words[j] |= other.blocks_[i].words[j];
+                }
+            }
+        }
+
+        void clear() noexcept {
+            std::ranges::fill(blocks_, Block{});
+        }
+
+        [[nodiscard]] std::size_t block_count() const noexcept {
+            return blocks_.size();
+        }
+
+        [[nodiscard]] std::uint32_t probes() const noexcept {
+            return probes_;
+        }
+
+        [[nodiscard]] std::size_t size_bytes() const noexcept {
+            return blocks_.size() * kBlockSize;
+        }
+
+        /// \brief Serialize the filter into a flat little-endian buffer, e.g. for `files::write_file`
+        [[nodiscard]] std::vector<std::uint8_t> serialize() const {
+            std::vector<std::uint8_t> result(kHeaderSize + size_bytes());
+            auto* ptr = result.data();
+            const auto write = [&ptr]<typename Ty>(const Ty value) -> void {
+                const auto le_value = numeric::to_le(value);
+                std::memcpy(ptr, &le_value, sizeof(Ty));
+                ptr += sizeof(Ty);
+            };
+
+            write(kMagic);
+            write(probes_);
+            write(static_cast<std::uint64_t>(blocks_.size()));
+            for (const auto& block : blocks_) {
+                for (const auto word : block.words) {
+                    write(word);
+                }
+            }
+            return result;
+        }
+
+        /// \brief Restore the filter from a buffer produced by `serialize`
+        /// \return std::nullopt if the buffer is malformed
+        [[nodiscard]] static std::optional<BloomFilter> deserialize(const std::span<const std::uint8_t> data) {
+            if (data.size() < kHeaderSize) {
+                return std::nullopt;
+            }
+
+            std::size_t offset = 0;
+            const auto read = [&data, &offset]<typename Ty>(std::type_identity<Ty>) -> Ty {
+                Ty value = 0;
+                std::memcpy(&value, data.data() + offset, sizeof(Ty));
+                offset += sizeof(Ty);
+                return numeric::to_le(value);
+            };
+
+            const auto magic = read(std::type_identity<std::uint32_t>{});
+            const auto probes = read(std::type_identity<std::uint32_t>{});
+            const auto blocks = read(std::type_identity<std::uint64_t>{});
+            if (magic != kMagic || probes == 0 || probes > kMaxProbes || blocks == 0 || blocks > kMaxBlocks ||
+                data.size() - kHeaderSize != blocks * kBlockSize) {
+                return std::nullopt;
+            }
+
+            BloomFilter result(static_cast<std::size_t>(blocks), probes);
+            for (auto& block : result.blocks_) {
+                for (auto& word : block.words) {
+                    word = read(std::type_identity<std::uint64_t>{});
+                }
+            }
+            return result;
+        }
+
+    private:
+        [[nodiscard]] std::size_t block_index(const std::uint64_t hash) const noexcept {
+            // Multiply-shift range reduction instead of a modulo
+            return static_cast<std::size_t>(((hash >> 32U) * blocks_.size()) >> 32U);
+        }
+
+        /// \brief Bits of the block that are set for the hash
+        [[nodiscard]] std::array<std::uint64_t, kWords> probe_mask(const std::uint64_t hash) const noexcept {
+            // The block is picked by the upper half, so the probes use a remixed hash to stay independent of it
+            const auto mixed = hash * 0x9e3779b97f4a7c15ULL;
+            const auto h1 = static_cast<std::uint32_t>(mixed);
+            const auto h2 = static_cast<std::uint32_t>(mixed >> 32U) | 1U;
+
+            std::array<std::uint64_t, kWords> result = {};
+            for (std::uint32_t i = 0; i < probes_; ++i) {
+                const auto bit = (h1 + i * h2) >> (32U - std::countr_zero(kBlockBits));
+                result[bit / 64] |= std::uint64_t{1} << (bit % 64);
+            }
+            return result;
+        }
+
+        template <typename Fn>
+        void for_each_group(const std::span<const std::uint64_t> hashes, Fn&& fn) const noexcept {
+            for (std::size_t i = 0; i < hashes.size(); i += kBatchSize) {
+                const auto group = hashes.subspan(i, std::min(kBatchSize, hashes.size() - i));
+                for (const auto hash : group) {
+                    COMMON_PREFETCH(&blocks_[block_index(hash)]);
+                }
+                for (std::size_t j = 0; j < group.size(); ++j) {
+                    fn(group[j], i + j);
+                }
+            }
+        }
+
+        std::uint32_t probes_;
+        std::vector<Block> blocks_ = {};
+    };
+} // namespace hashes
@@ -0,0 +1,148 @@
+#pragma once
+#include "es3n1n/common/cpu.hpp"
+#include "es3n1n/common/hashes/base.hpp"
+#include "es3n1n/common/hashes/fnv.hpp"
+#include "es3n1n/common/hashes/murmur.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+
+#if PLATFORM_IS_X86
+    #include <immintrin.h>
+#endif
+
+namespace hashes {
+    namespace detail {
+        /// \brief Convert an ASCII uppercase letter to the lowercase one, other characters are returned as is
+        template <Hashable CharTy>
+        [[nodiscard]] constexpr std::remove_cv_t<CharTy> fold_ascii_case(const CharTy value) noexcept {
+            using UnsignedTy = std::make_unsigned_t<std::remove_cv_t<CharTy>>;
+            const auto raw = std::bit_cast<UnsignedTy>(value);
+            if (static_cast<UnsignedTy>(raw - UnsignedTy{'A'}) > UnsignedTy{'Z' - 'A'}) {
+                return value;
+            }
+            return std::bit_cast<std::remove_cv_t<CharTy>>(static_cast<UnsignedTy>(raw | UnsignedTy{0x20}));
+        }
+
+#if PLATFORM_IS_X86
+        /// \brief Fold the case of every whole 32-byte block, returns the amount of folded bytes
+        /// \note Letters are moved to the bottom of the signed range, so that a single signed comparison detects them
+        COMMON_TARGET("avx2")
+        inline std::size_t fold_ascii_case_avx2(const std::uint8_t* input, std::uint8_t* output, const std::size_t size) noexcept {
+            const auto shift = _mm256_set1_epi8(static_cast<char>(0x80 - 'A'));
+            const auto limit = _mm256_set1_epi8(static_cast<char>(-0x80 + ('Z' - 'A' + 1)));
+            const auto lower_bit = _mm256_set1_epi8(0x20);
+
+            std::size_t offset = 0;
+            for (; offset + sizeof(__m256i) <= size; offset += sizeof(__m256i)) {
+                const auto data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + offset));
+                const auto upper = _mm256_cmpgt_epi8(limit, _mm256_add_epi8(data, shift));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + offset), _mm256_or_si256(data, _mm256_and_si256(upper, lower_bit)));
+            }
+            return offset;
+        }
+
+        /// \brief Fold the case of every whole 16-byte block, returns the amount of folded bytes
+        COMMON_TARGET("sse2")
+        inline std::size_t fold_ascii_case_sse2(const std::uint8_t* input, std::uint8_t* output, const std::size_t size) noexcept {
+            const auto shift = _mm_set1_epi8(static_cast<char>(0x80 - 'A'));
+            const auto limit = _mm_set1_epi8(static_cast<char>(-0x80 + ('Z' - 'A' + 1)));
+            const auto lower_bit = _mm_set1_epi8(0x20);
+
+            std::size_t offset = 0;
+            for (; offset + sizeof(__m128i) <= size; offset += sizeof(__m128i)) {
+                const auto data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + offset));
+                const auto upper = _mm_cmplt_epi8(_mm_add_epi8(data, shift), limit);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + offset), _mm_or_si128(data, _mm_and_si128(upper, lower_bit)));
+            }
+            return offset;
+        }
+#endif
+
+        /// \brief Fold the case of the characters into the output buffer
+        /// \note Single byte characters are folded with vector instructions at runtime
+        template <Hashable CharTy>
+        constexpr void fold_ascii_case(const std::span<CharTy> input, std::remove_cv_t<CharTy>* output) noexcept {
+            std::size_t offset = 0;
+#if PLATFORM_IS_X86
+            if constexpr (sizeof(CharTy) == 1) {
+                if (!std::is_constant_evaluated()) {
+                    const auto* input_bytes = reinterpret_cast<const std::uint8_t*>(input.data());
+                    auto* output_bytes = reinterpret_cast<std::uint8_t*>(output);
+                    if (cpu::features().avx2) {
+                        offset = fold_ascii_case_avx2(input_bytes, output_bytes, input.size());
+                    } else if (cpu::features().sse2) {
+                        offset = fold_ascii_case_sse2(input_bytes, output_bytes, input.size());
+                    }
+                }
+            }
+#endif
+
+            for (; offset < input.size(); ++offset) {
+                output[offset] = fold_ascii_case(input[offset]);
+            }
+        }
+    } // namespace detail
+
+    /// \brief Case-insensitive variant of a streaming hash function
+    /// \tparam Hash The hash function, it should support streaming
+    /// \note ASCII letters are lowercased on the fly, so the result is equal to `Hash::hash` of the lowercase string.
+    ///     The input is folded in chunks into a buffer on the stack, no allocations are made
+    template <typename Hash>
+        requires requires { typename Hash::State; }
+    class CaseInsensitive : public HashFunction<CaseInsensitive<Hash>, decltype(Hash::finalize(Hash::init()))> {
+        using Ty = decltype(Hash::finalize(Hash::init()));
+
+        /// \note A multiple of every block size, so that the streaming hashes don't have to buffer partial blocks between the chunks
+        static constexpr std::size_t kChunkSize = 256;
+
+    public:
+        using State = typename Hash::State;
+
+        [[nodiscard]] static constexpr State init() noexcept {
+            return Hash::init();
+        }
+
+        template <detail::Hashable CharTy>
+        static constexpr void update(State& state, const std::span<CharTy> value) noexcept {
+            std::array<std::remove_cv_t<CharTy>, kChunkSize> buffer;
+            for (std::size_t offset = 0; offset < value.size(); offset += kChunkSize) {
+                const auto chunk = value.subspan(offset, std::min(kChunkSize, value.size() - offset));
+                detail::fold_ascii_case(chunk, buffer.data());
+                Hash::update(state, std::span<const std::remove_cv_t<CharTy>>(buffer.data(), chunk.size()));
+            }
+        }
+
+        [[nodiscard]] static constexpr Ty finalize(const State& state) noexcept {
+            return Hash::finalize(state);
+        }
+
+        template <detail::Hashable CharTy>
+        [[nodiscard]] static constexpr Ty hash_impl(const std::span<CharTy> value) noexcept {
+            State state = init();
+            update(state, value);
+            return finalize(state);
+        }
+    };
+
+    using Fnv1a_32_ci = CaseInsensitive<Fnv1a_32>;
+    using Fnv1a_64_ci = CaseInsensitive<Fnv1a_64>;
+    using Murmur3_32_ci = CaseInsensitive<Murmur3_32>;
+    using Murmur3_64_ci = CaseInsensitive<Murmur3_64>;
+} // namespace hashes
+
+[[nodiscard]] consteval std::uint32_t operator""_fnv1a_32_ci(const char* value, std::size_t size) noexcept {
+    return hashes::Fnv1a_32_ci::hash(std::span(value, size));
+}
+
+[[nodiscard]] consteval std::uint64_t operator""_fnv1a_64_ci(const char* value, std::size_t size) noexcept {
+    return hashes::Fnv1a_64_ci::hash(std::span(value, size));
+}
+
+[[nodiscard]] consteval std::uint32_t operator""_murmur3_32_ci(const char* value, std::size_t size) noexcept {
+    return hashes::Murmur3_32_ci::hash(std::span(value, size));
+}
+
+[[nodiscard]] consteval std::uint64_t operator""_murmur3_64_ci(const char* value, std::size_t size) noexcept {
+    return hashes::Murmur3_64_ci::hash(std::span(value, size));
+}
@@ -0,0 +1,178 @@
+#pragma once
+#include "es3n1n/common/hashes/base.hpp"
+#include "es3n1n/common/hashes/murmur.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace hashes {
+    /// \brief Count-Min frequency sketch
+    /// \tparam Hash The 64-bit hash function, keys are hashed only once
+    /// \tparam CounterTy The counter type, counters saturate instead of overflowing
+    /// \note Estimates never undercount, they overcount by at most e / width * total with the probability of 1 - e^-depth
+    /// \see http://dimacs.rutgers.edu/~graham/pubs/papers/cm-full.pdf
+    template <typename Hash = Murmur3_64, std::unsigned_integral CounterTy = std::uint32_t>
+        requires std::same_as<decltype(Hash::hash(std::string_view{})), std::uint64_t>
+    class CountMinSketch {
+        static constexpr std::size_t kBatchSize = 16;
+
+    public:
+        /// \param width Amount of counters per row, should be a power of two
+        /// \param depth Amount of rows
+        /// \throws std::invalid_argument if any of the sizes is out of range
+        CountMinSketch(const std::size_t width, const std::size_t depth): width_(width), depth_(depth) {
+            if (!std::has_single_bit(width) || width > std::numeric_limits<std::uint32_t>::max()) {
+                throw std::invalid_argument("CountMinSketch: width should be a power of two");
+            }
+            if (depth == 0) {
+                throw std::invalid_argument("CountMinSketch: invalid depth");
+            }
+            if (width > std::numeric_limits<std::size_t>::max() / depth) {
+                throw std::invalid_argument("CountMinSketch: width * depth overflows");
+            }
+            counters_.resize(width * depth);
+        }
+
+        /// \brief Size the sketch for the error bound `epsilon * total` that holds with the probability of `1 - delta`
+        /// \throws std::invalid_argument if any of the parameters is not in (0, 1) or the sketch would be too wide
+        [[nodiscard]] static CountMinSketch with_error(const double epsilon, const double delta) {
+            if (!(epsilon > 0.0 && epsilon < 1.0) || !(delta > 0.0 && delta < 1.0)) {
+                throw std::invalid_argument("CountMinSketch: epsilon and delta should be in (0, 1)");
+            }
+            // The widest sketch is the largest power of two that fits in 32 bits, checked before the conversion
+            const auto min_width = std::ceil(std::numbers::e / epsilon);
+            if (min_width > static_cast<double>(std::bit_floor(std::numeric_limits<std::uint32_t>::max()))) {
+                throw std::invalid_argument("CountMinSketch: epsilon is too small");
+            }
+            const auto width = std::bit_ceil(static_cast<std::size_t>(min_width));
+            const auto depth = static_cast<std::size_t>(std::ceil(std::log(1.0 / delta)));
+            return {width, depth};
+        }
+
+        template <typename KeyTy>
+            requires requires(const KeyTy& key) { Hash::hash(key); }
+        void add(const KeyTy& key, const CounterTy count = 1) noexcept {
+            add_hash(Hash::hash(key), count);
+        }
+
+        template <typename KeyTy>
+            requires requires(const KeyTy& key) { Hash::hash(key); }
+        [[nodiscard]] CounterTy estimate(const KeyTy& key) const noexcept {
+            return estimate_hash(Hash::hash(key));
+        }
+
+        /// \brief Add the bytes of a trivially copyable object, e.g. an address
+        template <traits::TriviallyCopyable ObjTy>
+        void add_object(const ObjTy& value, const CounterTy count = 1) noexcept {
+            add_hash(Hash::hash_object(value), count);
+        }
+
+        template <traits::TriviallyCopyable ObjTy>
+        [[nodiscard]] CounterTy estimate_object(const ObjTy& value) const noexcept {
+            return estimate_hash(Hash::hash_object(value));
+        }
+
+        /// \brief Add a key by its hash, the hash should be computed with `Hash`
+        void add_hash(const std::uint64_t hash, const CounterTy count = 1) noexcept {
+            for (std::size_t row = 0; row < depth_; ++row) {
+                auto& counter = counters_[counter_index(hash, row)];
+                counter = saturating_add(counter, count);
+            }
+        }
+
+        [[nodiscard]] CounterTy estimate_hash(const std::uint64_t hash) const noexcept {
+            auto result = std::numeric_limits<CounterTy>::max();
+            for (std::size_t row = 0; row < depth_; ++row) {
+                result = std::min(result, counters_[counter_index(hash, row)]);
+            }
+            return result;
+        }
+
+        void add_hashes(const std::span<const std::uint64_t> hashes, const CounterTy count = 1) noexcept {
+            for (const auto hash : hashes) {
+                add_hash(hash, count);
+            }
+        }
+
+        /// \brief Estimate a batch of hashes, `out[i]` is set to `estimate_hash(hashes[i])`
+        void estimate_hashes(const std::span<const std::uint64_t> hashes, const std::span<CounterTy> out) const noexcept {
+            assert(out.size() >= hashes.size());
+            for (std::size_t i = 0; i < hashes.size(); ++i) {
+                out[i] = estimate_hash(hashes[i]);
+            }
+        }
+
+        /// \brief Add a batch of keys, they're hashed with `Hash::hash_many`
+        void add_many(const std::span<const std::string_view> keys, const CounterTy count = 1) noexcept {
+            std::array<std::uint64_t, kBatchSize> hashes = {};
+            for (std::size_t i = 0; i < keys.size(); i += kBatchSize) {
+                const auto group = keys.subspan(i, std::min(kBatchSize, keys.size() - i));
+                Hash::hash_many(group, std::span(hashes));
+                add_hashes(std::span(hashes).first(group.size()), count);
+            }
+        }
+
+        /// \brief Estimate a batch of keys, `out[i]` is set to `estimate(keys[i])`
+        void estimate_many(const std::span<const std::string_view> keys, const std::span<CounterTy> out) const noexcept {
+            assert(out.size() >= keys.size());
+            std::array<std::uint64_t, kBatchSize> hashes = {};
+            for (std::size_t i = 0; i < keys.size(); i += kBatchSize) {
+                const auto group = keys.subspan(i, std::min(kBatchSize, keys.size() - i));
+                Hash::hash_many(group, std::span(hashes));
+                estimate_hashes(std::span(hashes).first(group.size()), out.subspan(i, group.size()));
+            }
+        }
+
+        /// \brief Add all counts of the other sketch, e.g. to combine per-thread sketches
+        /// \throws std::invalid_argument if the sketches have different shapes
+        void merge(const CountMinSketch& other) {
+            if (other.width_ != width_ || other.depth_ != depth_) {
+                throw std::invalid_argument("CountMinSketch: unable to merge sketches of different shapes");
+            }
+            for (std::size_t i = 0; i < counters_.size(); ++i) {
+                counters_[i] = saturating_add(counters_[i], other.counters_[i]);
+            }
+        }
+
+        void clear() noexcept {
+            std::ranges::fill(counters_, CounterTy{0});
+        }
+
+        [[nodiscard]] std::size_t width() const noexcept {
+            return width_;
+        }
+
+        [[nodiscard]] std::size_t depth() const noexcept {
+            return depth_;
+        }
+
+        [[nodiscard]] std::size_t size_bytes() const noexcept {
+            return counters_.size() * sizeof(CounterTy);
+        }
+
+    private:
+        [[nodiscard]] static constexpr CounterTy saturating_add(const CounterTy lhs, const CounterTy rhs) noexcept {
+            const auto result = static_cast<CounterTy>(lhs + rhs);
+            return result < lhs ? std::numeric_limits<CounterTy>::max() : result;
+        }
+
+        /// \brief Index of the counter of the hash in the row, columns are derived with double hashing
+        [[nodiscard]] std::size_t counter_index(const std::uint64_t hash, const std::size_t row) const noexcept {
+            const auto h1 = static_cast<std::uint32_t>(hash);
+            const auto h2 = static_cast<std::uint32_t>(hash >> 32U) | 1U;
+            return row * width_ + ((h1 + static_cast<std::uint32_t>(row) * h2) & (width_ - 1));
+        }
+
+        std::size_t width_;
+        std::size_t depth_;
+        std::vector<CounterTy> counters_ = {};
+    };
+} // namespace hashes
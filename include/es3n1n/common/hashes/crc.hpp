@@ -1,45 +1,473 @@
 #pragma once
+#include "es3n1n/common/cpu.hpp"
 #include "es3n1n/common/hashes/base.hpp"
+#include "es3n1n/common/numeric.hpp"
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <climits>
+#include <cstring>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if PLATFORM_IS_X86
+    #include <immintrin.h>
+#endif
 
 namespace hashes {
-    /// \brief Fowler–Noll–Vo-1 hash function
-    /// \tparam Ty The size type for the hash
-    /// \see https://web.mit.edu/freebsd/head/sys/libkern/crc32.c
-    template <detail::HashSize Ty>
-        requires(std::is_same_v<Ty, std::uint32_t>) // we might add more hash sizes in the future though
-    class CrcB : public HashFunction<CrcB<Ty>, Ty> {
-        static constexpr std::uint32_t kCrc32Polynomial = 0xEDB88320;
-        static constexpr auto kCrc32Table = []() -> std::array<std::uint32_t, 0x100> {
-            std::array<std::uint32_t, 0x100> result = {};
-            for (std::size_t i = 0; i < 0x100; ++i) {
-                auto crc = static_cast<std::uint32_t>(i);
-                for (std::size_t bit = 0; bit < CHAR_BIT; bit++) {
-                    crc = (crc >> 1) ^ ((crc & 1) * kCrc32Polynomial);
-                }
-                // \note: @annihilatorq: .at() is used to avoid weird warning C28020, when static
-                // analyzer thinks the index may go out of bounds when using [], despite clear limits
-                result.at(i) = crc;
+    /// \brief Parameters of a CRC model, in the notation of the CRC catalogue
+    /// \tparam Ty The size type for the hash, it should be able to hold `Width` bits
+    /// \tparam Width The width of the crc, in bits
+    /// \tparam Polynomial The polynomial in the normal (MSB-first) representation, without the x^Width term
+    /// \tparam Init The initial value of the register
+    /// \tparam Reflect Whether the input bytes and the result are reflected (refin and refout)
+    /// \tparam XorOut The value that is xored with the final register
+    /// \see https://reveng.sourceforge.io/crc-catalogue/all.htm
+    template <detail::HashSize Ty, std::size_t Width, Ty Polynomial, Ty Init, bool Reflect, Ty XorOut>
+        requires(std::unsigned_integral<Ty> && Width > 0 && Width <= sizeof(Ty) * CHAR_BIT)
+    struct CrcParameters {
+        using ValueTy = Ty;
+
+        static constexpr std::size_t width = Width;
+        static constexpr Ty polynomial = Polynomial;
+        static constexpr Ty init = Init;
+        static constexpr bool reflect = Reflect;
+        static constexpr Ty xor_out = XorOut;
+    };
+
+    namespace detail {
+        /// \brief Reverse the order of the lowest `width` bits
+        template <std::unsigned_integral Ty>
+        [[nodiscard]] constexpr Ty reflect_bits(Ty value, const std::size_t width) noexcept {
+            Ty result = 0;
+            for (std::size_t i = 0; i < width; ++i, value >>= 1U) {
+                result = static_cast<Ty>((result << 1U) | (value & 1U));
+            }
+            return result;
+        }
+
+        /// \brief Lookup tables and table-driven kernels of a CRC model
+        /// \note Reflected registers hold the crc in the lowest bits, others are aligned to the top bit of the type,
+        ///     so that both of them consume the input a byte at a time regardless of the width
+        template <typename Parameters>
+        class CrcTables {
+        public:
+            using Ty = typename Parameters::ValueTy;
+
+            static constexpr std::size_t kBits = sizeof(Ty) * CHAR_BIT;
+            static constexpr std::size_t kShift = Parameters::reflect ? 0 : kBits - Parameters::width;
+            static constexpr Ty kPolynomial =
+                Parameters::reflect ? reflect_bits(Parameters::polynomial, Parameters::width) : static_cast<Ty>(Parameters::polynomial << kShift);
+            static constexpr Ty kInit = Parameters::reflect ? reflect_bits(Parameters::init, Parameters::width) : static_cast<Ty>(Parameters::init << kShift);
+
+            /// \brief Number of bytes consumed per iteration of the sliced loop, wide tables would not fit into the L1 otherwise
+            static constexpr std::size_t kSlicingBy = sizeof(Ty) > sizeof(std::uint32_t) ? 8 : 16;
+
+            /// \brief Advance the register by a single zero bit
+            [[nodiscard]] static constexpr Ty shift_bit(const Ty crc) noexcept {
+                if constexpr (Parameters::reflect) {
+                    return (crc & 1U) != 0 ? static_cast<Ty>((crc >> 1U) ^ kPolynomial) : static_cast<Ty>(crc >> 1U);
+                } else {
+                    return (crc >> (kBits - 1)) != 0 ? static_cast<Ty>((crc << 1U) ^ kPolynomial) : static_cast<Ty>(crc << 1U);
+                }
+            }
+
+            /// \brief Get the byte of the register that is consumed next
+            [[nodiscard]] static constexpr std::size_t byte_index(const Ty crc) noexcept {
+                return Parameters::reflect ? crc & 0xFFU : crc >> (kBits - CHAR_BIT);
+            }
+
+            /// \brief Drop the consumed byte of the register
+            [[nodiscard]] static constexpr Ty shift_byte(const Ty crc) noexcept {
+                return Parameters::reflect ? static_cast<Ty>(crc >> CHAR_BIT) : static_cast<Ty>(crc << CHAR_BIT);
+            }
+
+            static constexpr auto kTable = []() -> std::array<Ty, 0x100> {
+                std::array<Ty, 0x100> result = {};
+                for (std::size_t i = 0; i < 0x100; ++i) {
+                    auto crc = Parameters::reflect ? static_cast<Ty>(i) : static_cast<Ty>(static_cast<Ty>(i) << (kBits - CHAR_BIT));
+                    for (std::size_t bit = 0; bit < CHAR_BIT; bit++) {
+                        crc = shift_bit(crc);
+                    }
+                    // \note: @annihilatorq: .at() is used to avoid weird warning C28020, when static
+                    // analyzer thinks the index may go out of bounds when using [], despite clear limits
+                    result.at(i) = crc;
+                }
+                return result;
+            }();
+
+            /// \brief Slicing-by-N tables, where table[n][i] is the crc of byte i followed by n zero bytes
+            /// \see https://create.stephan-brumme.com/crc32/#slicing-by-16-overview
+            static constexpr auto kSlicingTable = []() -> std::array<std::array<Ty, 0x100>, kSlicingBy> {
+                std::array<std::array<Ty, 0x100>, kSlicingBy> result = {};
+                result.at(0) = kTable;
+                for (std::size_t slice = 1; slice < kSlicingBy; ++slice) {
+                    for (std::size_t i = 0; i < 0x100; ++i) {
+                        const auto prev = result.at(slice - 1).at(i);
+                        result.at(slice).at(i) = shift_byte(prev) ^ kTable.at(byte_index(prev));
+                    }
+                }
+                return result;
+            }();
+
+            /// \note Only the lowest byte of every character is consumed
+            template <Hashable CharTy>
+            [[nodiscard]] static constexpr Ty update_bytewise(Ty crc, const std::span<CharTy> value) noexcept {
+                for (auto& c : value) {
+                    const std::size_t index = (byte_index(crc) ^ static_cast<std::size_t>(c)) & 0xFF;
+                    crc = kTable[index] ^ shift_byte(crc);
+                }
+                return crc;
+            }
+
+            [[nodiscard]] static Ty update_sliced(Ty crc, const std::uint8_t* data, std::size_t size) noexcept {
+                using WordTy = std::conditional_t<(sizeof(Ty) > sizeof(std::uint32_t)), std::uint64_t, std::uint32_t>;
+                constexpr std::size_t kWordBits = sizeof(WordTy) * CHAR_BIT;
+                constexpr auto& t = kSlicingTable;
+
+                for (; size >= kSlicingBy; size -= kSlicingBy, data += kSlicingBy) {
+                    std::array<WordTy, kSlicingBy / sizeof(WordTy)> words = {};
+                    std::memcpy(words.data(), data, kSlicingBy);
+
+                    // The register is xored with the first bytes of the block, every byte is then looked up by its distance to the end
+                    Ty result = 0;
+                    [&]<std::size_t... Words>(std::index_sequence<Words...>) {
+                        const auto lookup = [&]<std::size_t Word>(std::integral_constant<std::size_t, Word>) {
+                            WordTy word = 0;
+                            if constexpr (Parameters::reflect) {
+                                word = numeric::to_le(words[Word]) ^ (Word == 0 ? static_cast<WordTy>(crc) : 0);
+                            } else {
+                                word = numeric::to_be(words[Word]) ^ (Word == 0 ? static_cast<WordTy>(static_cast<WordTy>(crc) << (kWordBits - kBits)) : 0);
+                            }
+
+                            [&]<std::size_t... Bytes>(std::index_sequence<Bytes...>) {
+                                constexpr auto kFirstTable = kSlicingBy - 1 - Word * sizeof(WordTy);
+                                if constexpr (Parameters::reflect) {
+                                    ((result ^= t[kFirstTable - Bytes][(word >> (Bytes * CHAR_BIT)) & 0xFF]), ...);
+                                } else {
+                                    ((result ^= t[kFirstTable - Bytes][(word >> (kWordBits - CHAR_BIT - Bytes * CHAR_BIT)) & 0xFF]), ...);
+                                }
+                            }(std::make_index_sequence<sizeof(WordTy)>{});
+                        };
+                        (lookup(std::integral_constant<std::size_t, Words>{}), ...);
+                    }(std::make_index_sequence<kSlicingBy / sizeof(WordTy)>{});
+                    crc = result;
+                }
+
+                return update_bytewise(crc, std::span(data, size));
+            }
+
+            [[nodiscard]] static constexpr Ty finalize(const Ty crc) noexcept {
+                return static_cast<Ty>((crc >> kShift) ^ Parameters::xor_out);
+            }
+
+            /// \brief Multiply two polynomials modulo the crc polynomial, both of them are reflected
+            [[nodiscard]] static constexpr Ty multiply_mod_p(const Ty a, Ty b) noexcept
+                requires(Parameters::reflect)
+            {
+                Ty result = 0;
+                for (Ty m = Ty{1} << (Parameters::width - 1); m != 0; m >>= 1U) {
+                    if ((a & m) != 0) {
+                        result ^= b;
+                    }
+                    b = shift_bit(b);
+                }
+                return result;
+            }
+
+            /// \brief x^(2^n) modulo the crc polynomial, for n in [0, 64)
+            static constexpr auto kX2nTable = []() -> std::array<Ty, 64> {
+                std::array<Ty, 64> result = {};
+                if constexpr (Parameters::reflect && Parameters::width >= 2) {
+                    result.at(0) = Ty{1} << (Parameters::width - 2); // x^1
+                    for (std::size_t i = 1; i < result.size(); ++i) {
+                        result.at(i) = multiply_mod_p(result.at(i - 1), result.at(i - 1));
+                    }
+                }
+                return result;
+            }();
+
+            /// \brief Combine the crcs of two sequences into the crc of their concatenation
+            /// \param crc_a Crc of the first sequence
+            /// \param crc_b Crc of the second sequence
+            /// \param len_b Length of the second sequence, in bytes
+            /// \note The initial register of the second sequence is shifted along with it, it is cancelled out unless it equals xorout
+            /// \see https://github.com/madler/zlib/blob/develop/crc32.c (crc32_combine)
+            [[nodiscard]] static constexpr Ty combine(const Ty crc_a, const Ty crc_b, std::uint64_t len_b) noexcept
+                requires(Parameters::reflect && Parameters::width >= 2)
+            {
+                // crc_a * x^(8 * len_b), computed as a product of x^(2^k) for each set bit of len_b * 8
+                Ty shift = Ty{1} << (Parameters::width - 1); // x^0
+                for (std::size_t k = 3; len_b != 0; len_b >>= 1U, ++k) {
+                    if ((len_b & 1U) != 0) {
+                        shift = multiply_mod_p(kX2nTable.at(k % kX2nTable.size()), shift);
+                    }
+                }
+                return multiply_mod_p(shift, crc_a ^ kInit ^ Parameters::xor_out) ^ crc_b;
+            }
+        };
+
+        /// \brief Inputs shorter than this are not worth spawning a thread for
+        constexpr std::size_t kCrcParallelMinimumChunkSize = 256 * 1024;
+
+        /// \brief Hash the chunks of the input on separate threads and combine the results
+        template <typename Hash, Hashable CharTy>
+        [[nodiscard]] auto crc_hash_parallel(const std::span<CharTy> value, std::size_t threads) {
+            using Ty = decltype(Hash::hash(value));
+
+            if (threads == 0) {
+                threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+            }
+            threads = std::clamp<std::size_t>(value.size() / kCrcParallelMinimumChunkSize, 1, threads);
+            if (threads == 1) {
+                return Hash::hash(value);
+            }
+
+            const std::size_t chunk_size = value.size() / threads;
+            std::vector<Ty> results(threads);
+            {
+                std::vector<std::jthread> workers;
+                workers.reserve(threads - 1);
+                for (std::size_t i = 1; i < threads; ++i) {
+                    const auto chunk = i + 1 == threads ? value.subspan(i * chunk_size) : value.subspan(i * chunk_size, chunk_size);
+                    workers.emplace_back([chunk, &result = results[i]]() -> void { result = Hash::hash(chunk); });
+                }
+                results[0] = Hash::hash(value.first(chunk_size));
+            }
+
+            Ty result = results[0];
+            for (std::size_t i = 1; i < threads; ++i) {
+                const std::size_t len = i + 1 == threads ? value.size() - i * chunk_size : chunk_size;
+                result = Hash::combine(result, results[i], len);
             }
             return result;
-        }();
+        }
+
+#if PLATFORM_IS_X86
+        /// \brief Minimal input size for the PCLMULQDQ kernel
+        constexpr std::size_t kCrc32ClmulMinimumSize = 64;
+
+        COMMON_TARGET("sse2") inline __m128i load_m128(const std::uint8_t* ptr) noexcept {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+        }
+
+        /// \brief Folds 128 bits of the state over the next 128 bits of the input
+        COMMON_TARGET("sse2,pclmul") inline __m128i clmul_fold(const __m128i value, const __m128i k, const __m128i next) noexcept {
+            const auto lo = _mm_clmulepi64_si128(value, k, 0x00);
+            const auto hi = _mm_clmulepi64_si128(value, k, 0x11);
+            return _mm_xor_si128(_mm_xor_si128(hi, lo), next);
+        }
+
+        /// \brief CRC32 (0xEDB88320) folding using carry-less multiplication
+        /// \param size Should be at least 64 bytes and a multiple of 16
+        /// \see https://www.intel.com/content/dam/www/public/us/en/documents/white-papers/fast-crc-computation-generic-polynomials-pclmulqdq-paper.pdf
+        /// \see https://chromium.googlesource.com/chromium/src/+/HEAD/third_party/zlib/crc32_simd.c
+        COMMON_TARGET("sse4.1,pclmul") inline std::uint32_t crc32_clmul(const std::uint32_t crc, const std::uint8_t* data, std::size_t size) noexcept {
+            const auto k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+            const auto k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+            const auto k5k0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+            const auto poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+            const auto mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+            // Fold by 4 with 64-byte blocks
+            auto x1 = _mm_xor_si128(load_m128(data), _mm_cvtsi32_si128(static_cast<int>(crc)));
+            auto x2 = load_m128(data + 0x10);
+            auto x3 = load_m128(data + 0x20);
+            auto x4 = load_m128(data + 0x30);
+            data += 64;
+            size -= 64;
+
+            for (; size >= 64; size -= 64, data += 64) {
+                x1 = clmul_fold(x1, k1k2, load_m128(data));
+                x2 = clmul_fold(x2, k1k2, load_m128(data + 0x10));
+                x3 = clmul_fold(x3, k1k2, load_m128(data + 0x20));
+                x4 = clmul_fold(x4, k1k2, load_m128(data + 0x30));
+            }
+
+            // Fold into 128 bits
+            x1 = clmul_fold(x1, k3k4, x2);
+            x1 = clmul_fold(x1, k3k4, x3);
+            x1 = clmul_fold(x1, k3k4, x4);
+
+            for (; size >= 16; size -= 16, data += 16) {
+                x1 = clmul_fold(x1, k3k4, load_m128(data));
+            }
+
+            // Fold 128 bits to 64 bits
+            x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+            x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+            x2 = _mm_srli_si128(x1, 4);
+            x1 = _mm_and_si128(x1, mask32);
+            x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+            x1 = _mm_xor_si128(x1, x2);
+
+            // Barrett reduction to 32 bits
+            x2 = _mm_and_si128(x1, mask32);
+            x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+            x2 = _mm_and_si128(x2, mask32);
+            x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+            x1 = _mm_xor_si128(x1, x2);
+
+            return static_cast<std::uint32_t>(_mm_extract_epi32(x1, 1));
+        }
+
+        /// \brief CRC32C (0x82F63B78) using the SSE4.2 crc32 instruction
+        COMMON_TARGET("sse4.2") inline std::uint32_t crc32c_sse42(std::uint32_t crc, const std::uint8_t* data, std::size_t size) noexcept {
+    #if defined(_M_X64) || defined(__x86_64__)
+            std::uint64_t crc64 = crc;
+            for (; size >= sizeof(std::uint64_t); size -= sizeof(std::uint64_t), data += sizeof(std::uint64_t)) {
+                std::uint64_t word = 0;
+                std::memcpy(&word, data, sizeof(word));
+                crc64 = _mm_crc32_u64(crc64, word);
+            }
+            crc = static_cast<std::uint32_t>(crc64);
+    #endif
+
+            for (; size >= sizeof(std::uint32_t); size -= sizeof(std::uint32_t), data += sizeof(std::uint32_t)) {
+                std::uint32_t word = 0;
+                std::memcpy(&word, data, sizeof(word));
+                crc = _mm_crc32_u32(crc, word);
+            }
+
+            for (; size > 0; --size, ++data) {
+                crc = _mm_crc32_u8(crc, *data);
+            }
+
+            return crc;
+        }
+#endif
+    } // namespace detail
+
+    /// \brief Generic CRC hash function
+    /// \tparam Parameters The CrcParameters of the model
+    /// \note Tables are generated at compile time, runtime hashing of bytes uses slicing-by-N,
+    ///     CRC-32 and CRC-32C are additionally accelerated with PCLMULQDQ and SSE4.2 respectively
+    template <typename Parameters>
+    class Crc : public HashFunction<Crc<Parameters>, typename Parameters::ValueTy> {
+        using Ty = typename Parameters::ValueTy;
+        using Tables = detail::CrcTables<Parameters>;
+
+        static constexpr bool kIsCrc32Reflected = std::is_same_v<Ty, std::uint32_t> && Parameters::width == 32 && Parameters::reflect;
+
+        [[nodiscard]] static Ty update_bytes(Ty crc, const std::uint8_t* data, std::size_t size) noexcept {
+#if PLATFORM_IS_X86
+            if constexpr (kIsCrc32Reflected && Parameters::polynomial == 0x04C11DB7) {
+                if (size >= detail::kCrc32ClmulMinimumSize && cpu::features().pclmul && cpu::features().sse41) {
+                    const std::size_t chunk = size & ~std::size_t{0xF};
+                    crc = detail::crc32_clmul(crc, data, chunk);
+                    data += chunk;
+                    size -= chunk;
+                }
+            } else if constexpr (kIsCrc32Reflected && Parameters::polynomial == 0x1EDC6F41) {
+                if (cpu::features().sse42) {
+                    return detail::crc32c_sse42(crc, data, size);
+                }
+            }
+#endif
+            return Tables::update_sliced(crc, data, size);
+        }
 
     public:
+        using State = Ty;
+
+        [[nodiscard]] static constexpr State init() noexcept {
+            return Tables::kInit;
+        }
+
         template <detail::Hashable CharTy>
-        [[nodiscard]] static constexpr Ty hash_impl(const std::span<CharTy> value) noexcept {
-            Ty result = ~Ty{0};
-            for (auto& c : value) {
-                std::size_t index = (result ^ static_cast<Ty>(c)) & 0xFF;
-                result = kCrc32Table[index] ^ (result >> 8);
+        static constexpr void update(State& state, const std::span<CharTy> value) noexcept {
+            /// \note Runtime kernels read raw bytes, so they are only valid for byte-sized characters
+            if constexpr (sizeof(CharTy) == 1) {
+                if (!std::is_constant_evaluated()) {
+                    state = update_bytes(state, reinterpret_cast<const std::uint8_t*>(value.data()), value.size());
+                    return;
+                }
             }
-            return ~result;
+
+            state = Tables::update_bytewise(state, value);
+        }
+
+        [[nodiscard]] static constexpr Ty finalize(const State state) noexcept {
+            return Tables::finalize(state);
+        }
+
+        /// \brief Get the crc of the concatenation of two sequences
+        /// \param len_b Length of the second sequence, in characters
+        [[nodiscard]] static constexpr Ty combine(const Ty crc_a, const Ty crc_b, const std::uint64_t len_b) noexcept
+            requires(Parameters::reflect && Parameters::width >= 2)
+        {
+            return Tables::combine(crc_a, crc_b, len_b);
+        }
+
+        /// \brief Hash the input on multiple threads, produces the same result as hash()
+        /// \param threads Maximal number of threads to use, 0 means the hardware concurrency
+        template <detail::Hashable CharTy>
+        [[nodiscard]] static Ty hash_parallel(const std::span<CharTy> value, const std::size_t threads = 0)
+            requires(Parameters::reflect && Parameters::width >= 2)
+        {
+            return detail::crc_hash_parallel<Crc>(value, threads);
+        }
+
+        template <detail::Hashable CharTy>
+        [[nodiscard]] static constexpr Ty hash_impl(const std::span<CharTy> value) noexcept {
+            State state = init();
+            update(state, value);
+            return finalize(state);
         }
     };
 
+    /// \brief CRC-32 hash function (ISO-HDLC, polynomial 0xEDB88320)
+    /// \tparam Ty The size type for the hash
+    /// \see https://web.mit.edu/freebsd/head/sys/libkern/crc32.c
+    template <detail::HashSize Ty>
+        requires(std::is_same_v<Ty, std::uint32_t>)
+    using CrcB = Crc<CrcParameters<Ty, 32, 0x04C11DB7, 0xFFFFFFFF, true, 0xFFFFFFFF>>;
+
+    /// \brief CRC-32C hash function (Castagnoli, polynomial 0x82F63B78)
+    /// \tparam Ty The size type for the hash
+    /// \see https://datatracker.ietf.org/doc/html/rfc3720#appendix-B.4
+    template <detail::HashSize Ty>
+        requires(std::is_same_v<Ty, std::uint32_t>)
+    using CrcC = Crc<CrcParameters<Ty, 32, 0x1EDC6F41, 0xFFFFFFFF, true, 0xFFFFFFFF>>;
+
     using Crcb_32 = CrcB<std::uint32_t>;
+    using Crc32c = CrcC<std::uint32_t>;
+    /// \brief CRC-16/IBM-3740, also known as CRC-16/CCITT-FALSE
+    using Crc16_ccitt = Crc<CrcParameters<std::uint16_t, 16, 0x1021, 0xFFFF, false, 0>>;
+    /// \brief CRC-16/KERMIT, the reflected CCITT variant
+    using Crc16_kermit = Crc<CrcParameters<std::uint16_t, 16, 0x1021, 0, true, 0>>;
+    /// \brief CRC-64/ECMA-182
+    using Crc64_ecma = Crc<CrcParameters<std::uint64_t, 64, 0x42F0E1EBA9EA3693, 0, false, 0>>;
+    /// \brief CRC-64/XZ, the reflected ECMA-182 variant
+    using Crc64_xz = Crc<CrcParameters<std::uint64_t, 64, 0x42F0E1EBA9EA3693, ~std::uint64_t{0}, true, ~std::uint64_t{0}>>;
+
+    /// \brief Get the crc32 of the concatenation of two sequences
+    /// \param crc_a Crcb_32 of the first sequence
+    /// \param crc_b Crcb_32 of the second sequence
+    /// \param len_b Length of the second sequence, in bytes
+    [[nodiscard]] constexpr std::uint32_t crc32_combine(const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t len_b) noexcept {
+        return Crcb_32::combine(crc_a, crc_b, len_b);
+    }
 } // namespace hashes
 
 inline consteval std::uint32_t operator""_crcb_32(const char* value, std::size_t size) noexcept {
     return hashes::Crcb_32::hash(std::span(value, size));
 }
+
+inline consteval std::uint32_t operator""_crc32c(const char* value, std::size_t size) noexcept {
+    return hashes::Crc32c::hash(std::span(value, size));
+}
+
+inline consteval std::uint16_t operator""_crc16_ccitt(const char* value, std::size_t size) noexcept {
+    return hashes::Crc16_ccitt::hash(std::span(value, size));
+}
+
+inline consteval std::uint64_t operator""_crc64_ecma(const char* value, std::size_t size) noexcept {
+    return hashes::Crc64_ecma::hash(std::span(value, size));
+}
+
+inline consteval std::uint64_t operator""_crc64_xz(const char* value, std::size_t size) noexcept {
+    return hashes::Crc64_xz::hash(std::span(value, size));
+}
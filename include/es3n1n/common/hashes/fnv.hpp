@@ -1,5 +1,6 @@
 #pragma once
 #include "es3n1n/common/hashes/base.hpp"
+#include <array>
 
 namespace hashes {
     template <detail::HashSize Ty>
@@ -16,14 +17,29 @@ namespace hashes {
         using Parameters = FnvParameters<Ty>;
 
     public:
+        using State = Ty;
+
+        [[nodiscard]] static constexpr State init() noexcept {
+            return Parameters::basis;
+        }
+
         template <detail::Hashable CharTy>
-        [[nodiscard]] static constexpr Ty hash_impl(const std::span<CharTy> value) noexcept {
-            Ty result = Parameters::basis;
+        static constexpr void update(State& state, const std::span<CharTy> value) noexcept {
             for (auto& c : value) {
-                result *= Parameters::prime;
-                result ^= static_cast<Ty>(c);
+                state *= Parameters::prime;
+                state ^= static_cast<Ty>(c);
             }
-            return result;
+        }
+
+        [[nodiscard]] static constexpr Ty finalize(const State state) noexcept {
+            return state;
+        }
+
+        template <detail::Hashable CharTy>
+        [[nodiscard]] static constexpr Ty hash_impl(const std::span<CharTy> value) noexcept {
+            State state = init();
+            update(state, value);
+            return finalize(state);
         }
     };
 
@@ -35,14 +51,62 @@ namespace hashes {
         using Parameters = FnvParameters<Ty>;
 
     public:
+        using State = Ty;
+
+        [[nodiscard]] static constexpr State init() noexcept {
+            return Parameters::basis;
+        }
+
         template <detail::Hashable CharTy>
-        [[nodiscard]] static constexpr Ty hash_impl(const std::span<CharTy> value) noexcept {
-            Ty result = Parameters::basis;
+        static constexpr void update(State& state, const std::span<CharTy> value) noexcept {
             for (auto& c : value) {
-                result ^= static_cast<Ty>(c);
-                result *= Parameters::prime;
+                state ^= static_cast<Ty>(c);
+                state *= Parameters::prime;
+            }
+        }
+
+        [[nodiscard]] static constexpr Ty finalize(const State state) noexcept {
+            return state;
+        }
+
+        template <detail::Hashable CharTy>
+        [[nodiscard]] static constexpr Ty hash_impl(const std::span<CharTy> value) noexcept {
+            State state = init();
+            update(state, value);
+            return finalize(state);
+        }
+
+        /// \brief Hash the keys in groups of `kBatchLanes`, the lanes are independent so their multiplications can overlap
+        template <detail::Hashable CharTy>
+        static constexpr void hash_many_impl(const std::span<const std::basic_string_view<CharTy>> values, const std::span<Ty> out) noexcept {
+            std::size_t i = 0;
+            for (; values.size() - i >= detail::kBatchLanes; i += detail::kBatchLanes) {
+                const auto group = values.subspan(i, detail::kBatchLanes);
+                const auto common_size = detail::common_size(group);
+
+                std::array<const CharTy*, detail::kBatchLanes> data = {};
+                std::array<State, detail::kBatchLanes> states = {};
+                detail::for_each_lane([&](const std::size_t lane) {
+                    data[lane] = group[lane].data();
+                    states[lane] = init();
+                });
+
+                for (std::size_t offset = 0; offset < common_size; ++offset) {
+                    detail::for_each_lane([&](const std::size_t lane) {
+                        states[lane] ^= static_cast<Ty>(data[lane][offset]);
+                        states[lane] *= Parameters::prime;
+                    });
+                }
+
+                detail::for_each_lane([&](const std::size_t lane) {
+                    update(states[lane], std::span(group[lane]).subspan(common_size));
+                    out[i + lane] = finalize(states[lane]);
+                });
+            }
+
+            for (; i < values.size(); ++i) {
+                out[i] = hash_impl(std::span(values[i]));
             }
-            return result;
         }
     };
 
@@ -0,0 +1,104 @@
+#pragma once
+#include "es3n1n/common/hashes/base.hpp"
+#include "es3n1n/common/hashes/murmur.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <string_view>
+#include <vector>
+
+namespace hashes {
+    /// \brief HyperLogLog distinct count estimator
+    /// \tparam Precision Amount of hash bits that select a register, the sketch uses 2^Precision bytes
+    /// \tparam Hash The 64-bit hash function
+    /// \note The standard error of the estimate is about 1.04 / sqrt(2^Precision), e.g. 0.8% for the default precision
+    /// \see https://algo.inria.fr/flajolet/Publications/FlFuGaMe07.pdf
+    template <std::size_t Precision = 14, typename Hash = Murmur3_64>
+        requires(Precision >= 4 && Precision <= 18 && std::same_as<decltype(Hash::hash(std::string_view{})), std::uint64_t>)
+    class HyperLogLog {
+        static constexpr std::size_t kBatchSize = 16;
+
+    public:
+        static constexpr std::size_t kRegisters = std::size_t{1} << Precision;
+
+        HyperLogLog(): registers_(kRegisters) { }
+
+        template <typename KeyTy>
+            requires requires(const KeyTy& key) { Hash::hash(key); }
+        void add(const KeyTy& key) noexcept {
+            add_hash(Hash::hash(key));
+        }
+
+        /// \brief Add the bytes of a trivially copyable object, e.g. an address
+        template <traits::TriviallyCopyable ObjTy>
+        void add_object(const ObjTy& value) noexcept {
+            add_hash(Hash::hash_object(value));
+        }
+
+        /// \brief Add a key by its hash, the hash should be computed with `Hash`
+        void add_hash(const std::uint64_t hash) noexcept {
+            // The top bits pick the register, the position of the first set bit of the rest is the rank.
+            // The sentinel bit limits the rank in case all the remaining bits are zero
+            const auto index = static_cast<std::size_t>(hash >> (64U - Precision));
+            const auto rest = (hash << Precision) | (std::uint64_t{1} << (Precision - 1));
+            const auto rank = static_cast<std::uint8_t>(std::countl_zero(rest) + 1);
+            registers_[index] = std::max(registers_[index], rank);
+        }
+
+        void add_hashes(const std::span<const std::uint64_t> hashes) noexcept {
+            for (const auto hash : hashes) {
+                add_hash(hash);
+            }
+        }
+
+        /// \brief Add a batch of keys, they're hashed with `Hash::hash_many`
+        void add_many(const std::span<const std::string_view> keys) noexcept {
+            std::array<std::uint64_t, kBatchSize> hashes = {};
+            for (std::size_t i = 0; i < keys.size(); i += kBatchSize) {
+                const auto group = keys.subspan(i, std::min(kBatchSize, keys.size() - i));
+                Hash::hash_many(group, std::span(hashes));
+                add_hashes(std::span(hashes).first(group.size()));
+            }
+        }
+
+        /// \brief Estimate the amount of distinct keys
+        [[nodiscard]] double estimate() const noexcept {
+            constexpr auto kCount = static_cast<double>(kRegisters);
+            constexpr double kAlpha = 0.7213 / (1.0 + 1.079 / kCount);
+
+            double sum = 0.0;
+            std::size_t zeros = 0;
+            for (const auto value : registers_) {
+                sum += std::ldexp(1.0, -static_cast<int>(value));
+                zeros += value == 0 ? 1 : 0;
+            }
+
+            const auto raw = kAlpha * kCount * kCount / sum;
+            // Linear counting is much more precise for small cardinalities
+            if (raw <= 2.5 * kCount && zeros != 0) {
+                return kCount * std::log(kCount / static_cast<double>(zeros));
+            }
+            return raw;
+        }
+
+        /// \brief Add all keys of the other sketch, e.g. to combine per-thread sketches
+        void merge(const HyperLogLog& other) noexcept {
+            for (std::size_t i = 0; i < kRegisters; ++i) {
+                registers_[i] = std::max(registers_[i], other.registers_[i]);
+            }
+        }
+
+        void clear() noexcept {
+            std::ranges::fill(registers_, std::uint8_t{0});
+        }
+
+        [[nodiscard]] static constexpr std::size_t size_bytes() noexcept {
+            return kRegisters;
+        }
+
+    private:
+        std::vector<std::uint8_t> registers_;
+    };
+} // namespace hashes
@@ -0,0 +1,161 @@
+#pragma once
+#include "es3n1n/common/base.hpp"
+#include "es3n1n/common/hashes/fnv.hpp"
+#include "es3n1n/common/strong_integral.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace hashes {
+    /// \brief Handle of an interned string, equal strings of the same interner have equal handles
+    using InternedString = types::StrongIntegral<std::uint32_t, struct InternedStringTag>;
+
+    /// \brief Thread-safe string interning pool
+    /// \tparam Hash The hash function used for the index
+    /// \note Every unique string is copied once into an arena that never moves, handles and views stay valid for the lifetime of the interner
+    template <typename Hash = Fnv1a_32>
+    class Interner : public base::NonCopyable {
+        using HashTy = decltype(Hash::hash(std::string_view{}));
+
+        /// \brief Open addressing index slot, `id` is the handle + 1, zero marks an empty slot
+        struct Slot {
+            HashTy hash = 0;
+            std::uint32_t id = 0;
+        };
+
+        static constexpr std::size_t kChunkSize = 64 * 1024;
+        static constexpr std::size_t kInitialSlots = 64;
+
+    public:
+        Interner() = default;
+
+        /// \brief Intern the string
+        /// \return Handle of the stored copy
+        /// \throws std::length_error if there are no more handles left
+        [[nodiscard]] InternedString intern(const std::string_view value) {
+            const auto hash = Hash::hash(value);
+            {
+                std::shared_lock lock(mutex_);
+                if (const auto result = find_locked(value, hash); result.has_value()) {
+                    return *result;
+                }
+            }
+
+            std::unique_lock lock(mutex_);
+            // Someone could've interned the same string while we were waiting for the lock
+            if (const auto result = find_locked(value, hash); result.has_value()) {
+                return *result;
+            }
+
+            if (strings_.size() >= std::numeric_limits<std::uint32_t>::max()) {
+                throw std::length_error("Interner: out of handles");
+            }
+            if ((strings_.size() + 1) * 2 > slots_.size()) {
+                rehash(std::max(slots_.size() * 2, kInitialSlots));
+            }
+
+            const auto id = static_cast<std::uint32_t>(strings_.size());
+            strings_.emplace_back(store(value));
+            place(Slot{.hash = hash, .id = id + 1});
+            return InternedString{id};
+        }
+
+        /// \brief Find the handle of an already interned string
+        [[nodiscard]] std::optional<InternedString> find(const std::string_view value) const {
+            const auto hash = Hash::hash(value);
+            std::shared_lock lock(mutex_);
+            return find_locked(value, hash);
+        }
+
+        /// \brief Get the interned string, the view is null terminated
+        /// \note The handle should be obtained from this interner
+        [[nodiscard]] std::string_view view(const InternedString handle) const {
+            std::shared_lock lock(mutex_);
+            return strings_.at(handle.value());
+        }
+
+        /// \brief Get the amount of unique strings
+        [[nodiscard]] std::size_t size() const {
+            std::shared_lock lock(mutex_);
+            return strings_.size();
+        }
+
+    private:
+        [[nodiscard]] std::optional<InternedString> find_locked(const std::string_view value, const HashTy hash) const noexcept {
+            if (slots_.empty()) {
+                return std::nullopt;
+            }
+
+            const auto mask = slots_.size() - 1;
+            for (auto index = static_cast<std::size_t>(hash) & mask;; index = (index + 1) & mask) {
+                const auto& slot = slots_[index];
+                if (slot.id == 0) {
+                    return std::nullopt;
+                }
+                if (slot.hash == hash && strings_[slot.id - 1] == value) {
+                    return InternedString{slot.id - 1};
+                }
+            }
+        }
+
+        void place(const Slot slot) noexcept {
+            const auto mask = slots_.size() - 1;
+            auto index = static_cast<std::size_t>(slot.hash) & mask;
+            while (slots_[index].id != 0) {
+                index = (index + 1) & mask;
+            }
+            slots_[index] = slot;
+        }
+
+        void rehash(const std::size_t size) {
+            auto old_slots = std::exchange(slots_, std::vector<Slot>(size));
+            for (const auto& slot : old_slots) {
+                if (slot.id != 0) {
+                    place(slot);
+                }
+            }
+        }
+
+        /// \brief Copy the string into the arena, the copy is null terminated
+        [[nodiscard]] std::string_view store(const std::string_view value) {
+            const auto size = value.size() + 1;
+
+            char* result = nullptr;
+            if (size > kChunkSize / 4) {
+                // Large strings get a chunk of their own, the partially used chunk stays the last one
+                auto chunk = std::make_unique_for_overwrite<char[]>(size);
+                result = chunk.get();
+                if (chunks_.empty()) {
+                    chunk_used_ = kChunkSize;
+                }
+                chunks_.insert(chunks_.empty() ? chunks_.end() : std::prev(chunks_.end()), std::move(chunk));
+            } else {
+                if (chunks_.empty() || size > kChunkSize - chunk_used_) {
+                    chunks_.emplace_back(std::make_unique_for_overwrite<char[]>(kChunkSize));
+                    chunk_used_ = 0;
+                }
+                result = chunks_.back().get() + chunk_used_;
+                chunk_used_ += size;
+            }
+
+            std::memcpy(result, value.data(), value.size());
+            result[value.size()] = '\0';
+            return {result, value.size()};
+        }
+
+        mutable std::shared_mutex mutex_ = {};
+        std::vector<std::unique_ptr<char[]>> chunks_ = {};
+        std::size_t chunk_used_ = 0;
+        std::vector<std::string_view> strings_ = {};
+        std::vector<Slot> slots_ = {};
+    };
+} // namespace hashes
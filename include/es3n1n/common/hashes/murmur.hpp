@@ -1,9 +1,14 @@
 #pragma once
+#include "es3n1n/common/cpu.hpp"
 #include "es3n1n/common/hashes/base.hpp"
 #include "es3n1n/common/numeric.hpp"
 #include <array>
 #include <climits>
 
+#if PLATFORM_IS_X86
+    #include <immintrin.h>
+#endif
+
 namespace hashes {
     namespace detail {
         template <detail::HashSize Ty, std::endian Endian = std::endian::little>
@@ -24,6 +29,61 @@ namespace hashes {
             static constexpr Ty fmix_shift_2 = sizeof(Ty) == 4 ? 13 : 33;
             static constexpr Ty fmix_shift_3 = sizeof(Ty) == 4 ? 16 : 33;
         };
+
+        /// \brief Constants of the x64_128 variant, the 64-bit lanes are mixed with their own rotations and offsets
+        struct Murmur128Parameters {
+            static constexpr std::uint64_t c1 = 0x87c37b91114253d5;
+            static constexpr std::uint64_t c2 = 0x4cf5ad432745937f;
+
+            static constexpr int k1_rot = 31;
+            static constexpr int k2_rot = 33;
+            static constexpr int h1_rot = 27;
+            static constexpr int h2_rot = 31;
+            static constexpr std::uint64_t m = 5;
+            static constexpr std::uint64_t n1 = 0x52dce729;
+            static constexpr std::uint64_t n2 = 0x38495ab5;
+
+            static constexpr std::uint64_t fmix_c1 = 0xff51afd7ed558ccd;
+            static constexpr std::uint64_t fmix_c2 = 0xc4ceb9fe1a85ec53;
+            static constexpr int fmix_shift = 33;
+        };
+
+#if PLATFORM_IS_X86
+        template <int Count>
+        COMMON_TARGET("avx2") inline __m256i murmur3_rotl_avx2(const __m256i value) noexcept {
+            return _mm256_or_si256(_mm256_slli_epi32(value, Count), _mm256_srli_epi32(value, 32 - Count));
+        }
+
+        /// \brief Mix the first `size` bytes of 8 keys at once, every 32-bit lane holds the state of one key
+        /// \note `size` must be a multiple of the block size
+        template <typename Parameters>
+        COMMON_TARGET("avx2")
+        inline void murmur3_mix_avx2(std::array<std::uint32_t, 8>& h, const std::array<const std::uint8_t*, 8>& data, const std::size_t size) noexcept {
+            const auto c1 = _mm256_set1_epi32(static_cast<int>(Parameters::c1));
+            const auto c2 = _mm256_set1_epi32(static_cast<int>(Parameters::c2));
+            const auto m = _mm256_set1_epi32(static_cast<int>(Parameters::m));
+            const auto n = _mm256_set1_epi32(static_cast<int>(Parameters::n));
+            const auto load = [&data](const std::size_t lane, const std::size_t offset) -> int {
+                int result = 0;
+                std::memcpy(&result, data[lane] + offset, sizeof(result));
+                return result;
+            };
+
+            auto state = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(h.data()));
+            for (std::size_t offset = 0; offset < size; offset += sizeof(std::uint32_t)) {
+                auto k = _mm256_setr_epi32(load(0, offset), load(1, offset), load(2, offset), load(3, offset), //
+                                           load(4, offset), load(5, offset), load(6, offset), load(7, offset));
+                k = _mm256_mullo_epi32(k, c1);
+                k = murmur3_rotl_avx2<Parameters::r1>(k);
+                k = _mm256_mullo_epi32(k, c2);
+
+                state = _mm256_xor_si256(state, k);
+                state = murmur3_rotl_avx2<Parameters::r2>(state);
+                state = _mm256_add_epi32(_mm256_mullo_epi32(state, m), n);
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(h.data()), state);
+        }
+#endif
     } // namespace detail
 
     /// \brief Murmur3 hash function
@@ -32,63 +92,94 @@ namespace hashes {
     ///     so hash(L"hello") and hash("hello") will produce different results
     /// \see https://en.wikipedia.org/wiki/MurmurHash
     template <detail::HashSize Ty, Ty Seed = 0, typename Parameters = detail::MurmurParameters<Ty>>
-        requires(std::is_same_v<Ty, std::uint32_t>) /// \todo @es3n1n: Add support for 128-bit hashes once we have a 128-bit integer type
-    class Murmur3 : public HashFunction<Murmur3<Ty>, Ty> {
+        requires(std::is_same_v<Ty, std::uint32_t>) // see Murmur3x64 for 64/128-bit hashes
+    class Murmur3 : public HashFunction<Murmur3<Ty, Seed, Parameters>, Ty> {
+        /// \brief Read a block starting at the specified byte offset
         template <detail::Hashable CharTy>
         [[nodiscard]] static constexpr Ty read_imm(const std::span<CharTy>& value, const std::size_t offset) noexcept {
-            Ty result = 0;
-            const std::size_t remaining = value.size() - offset;
-            const std::size_t bytes_to_read = std::min(sizeof(Ty), remaining * sizeof(CharTy));
-
-            for (std::size_t i = 0; i < bytes_to_read; ++i) {
-                const std::size_t char_index = offset + (i / sizeof(CharTy));
-                const std::size_t byte_index = i % sizeof(CharTy);
-
-                const auto char_val = std::bit_cast<std::make_unsigned_t<CharTy>>(value[char_index]);
-                const auto shift_count = byte_index * CHAR_BIT;
-                const auto byte = static_cast<std::uint8_t>((char_val >> shift_count) & 0xFFU);
-                result |= static_cast<Ty>(byte) << (i * CHAR_BIT);
-            }
+            return numeric::to_endian(detail::read_le<Ty>(value, offset), Parameters::endian);
+        }
 
-            return numeric::to_endian(result, Parameters::endian);
+        [[nodiscard]] static constexpr Ty scramble(Ty k) noexcept {
+            k *= Parameters::c1;
+            k = std::rotl(k, Parameters::r1);
+            k *= Parameters::c2;
+            return k;
         }
 
-    public:
+        static constexpr void mix_block(Ty& h, const Ty k) noexcept {
+            h ^= scramble(k);
+            h = std::rotl(h, Parameters::r2);
+            h = h * Parameters::m + Parameters::n;
+        }
+
+        /// \brief Mix the blocks of every lane with the vectorized kernel, if it's available
+        /// \return true if the blocks were mixed
         template <detail::Hashable CharTy>
-        [[nodiscard]] static constexpr Ty hash_impl(const std::span<CharTy> value) noexcept {
+        static constexpr bool mix_lanes_simd(std::array<Ty, detail::kBatchLanes>& h,
+                                             const std::array<std::span<const CharTy>, detail::kBatchLanes>& blocks) noexcept {
+#if PLATFORM_IS_X86
+            if constexpr (sizeof(CharTy) == 1 && detail::kBatchLanes == 8 && Parameters::endian == std::endian::little) {
+                if (!std::is_constant_evaluated() && cpu::features().avx2) {
+                    std::array<const std::uint8_t*, detail::kBatchLanes> data = {};
+                    detail::for_each_lane([&](const std::size_t lane) { data[lane] = reinterpret_cast<const std::uint8_t*>(blocks[lane].data()); });
+                    detail::murmur3_mix_avx2<Parameters>(h, data, blocks.front().size());
+                    return true;
+                }
+            }
+#endif
+            return false;
+        }
+
+    public:
+        /// \brief Streaming state, bytes that don't form a complete block yet are kept in `tail`
+        struct State {
             Ty h = Seed;
+            Ty tail = 0;
+            std::size_t tail_size = 0;
+            std::size_t length = 0;
+        };
 
-            const std::size_t len = value.size() * sizeof(CharTy);
-            const std::size_t num_blocks = len / sizeof(Ty);
+        [[nodiscard]] static constexpr State init() noexcept {
+            return {};
+        }
 
-            for (std::size_t i = 0; i < num_blocks; ++i) {
-                auto k = read_imm(value, i * sizeof(Ty) / sizeof(CharTy));
+        template <detail::Hashable CharTy>
+        static constexpr void update(State& state, const std::span<CharTy> value) noexcept {
+            const std::size_t len = value.size() * sizeof(CharTy);
+            std::size_t offset = 0;
+            state.length += len;
 
-                k *= Parameters::c1;
-                k = std::rotl(k, Parameters::r1);
-                k *= Parameters::c2;
+            // Complete the block left over from the previous update first
+            if (state.tail_size != 0) {
+                for (; offset < len && state.tail_size < sizeof(Ty); ++offset, ++state.tail_size) {
+                    state.tail |= static_cast<Ty>(detail::read_byte(value, offset)) << (state.tail_size * CHAR_BIT);
+                }
+                if (state.tail_size < sizeof(Ty)) {
+                    return;
+                }
 
-                h ^= k;
-                h = std::rotl(h, Parameters::r2);
-                h = h * Parameters::m + Parameters::n;
+                mix_block(state.h, numeric::to_endian(state.tail, Parameters::endian));
+                state.tail = 0;
+                state.tail_size = 0;
             }
 
-            const auto tail = value.subspan(num_blocks * sizeof(Ty) / sizeof(CharTy));
-            Ty k = 0;
+            for (; len - offset >= sizeof(Ty); offset += sizeof(Ty)) {
+                mix_block(state.h, read_imm(value, offset));
+            }
 
-            if (!tail.empty()) {
-                const std::size_t max_shift = sizeof(Ty) * CHAR_BIT;
-                for (std::size_t i = 0; i < tail.size() && (i * sizeof(CharTy) * CHAR_BIT) < max_shift; ++i) {
-                    k ^= static_cast<Ty>(tail[i]) << (i * sizeof(CharTy) * CHAR_BIT);
-                }
+            for (; offset < len; ++offset, ++state.tail_size) {
+                state.tail |= static_cast<Ty>(detail::read_byte(value, offset)) << (state.tail_size * CHAR_BIT);
+            }
+        }
 
-                k *= Parameters::c1;
-                k = std::rotl(k, Parameters::r1);
-                k *= Parameters::c2;
-                h ^= k;
+        [[nodiscard]] static constexpr Ty finalize(const State& state) noexcept {
+            Ty h = state.h;
+            if (state.tail_size != 0) {
+                h ^= scramble(state.tail);
             }
 
-            h ^= static_cast<Ty>(len);
+            h ^= static_cast<Ty>(state.length);
 
             h ^= h >> Parameters::fmix_shift_1;
             h *= Parameters::fmix_c1;
@@ -97,11 +188,201 @@ namespace hashes {
             h ^= h >> Parameters::fmix_shift_3;
             return h;
         }
+
+        template <detail::Hashable CharTy>
+        [[nodiscard]] static constexpr Ty hash_impl(const std::span<CharTy> value) noexcept {
+            State state = init();
+            update(state, value);
+            return finalize(state);
+        }
+
+        /// \brief Hash the keys in groups of `kBatchLanes`, blocks that every key of the group has are mixed in lockstep
+        template <detail::Hashable CharTy>
+        static constexpr void hash_many_impl(const std::span<const std::basic_string_view<CharTy>> values, const std::span<Ty> out) noexcept {
+            std::size_t i = 0;
+            for (; values.size() - i >= detail::kBatchLanes; i += detail::kBatchLanes) {
+                const auto group = values.subspan(i, detail::kBatchLanes);
+                const auto common_size = detail::common_size(group) * sizeof(CharTy) / sizeof(Ty) * sizeof(Ty);
+
+                std::array<std::span<const CharTy>, detail::kBatchLanes> blocks = {};
+                std::array<Ty, detail::kBatchLanes> h = {};
+                detail::for_each_lane([&](const std::size_t lane) {
+                    blocks[lane] = std::span(group[lane].data(), common_size / sizeof(CharTy));
+                    h[lane] = init().h;
+                });
+
+                if (!mix_lanes_simd(h, blocks)) {
+                    for (std::size_t offset = 0; offset < common_size; offset += sizeof(Ty)) {
+                        detail::for_each_lane([&](const std::size_t lane) { mix_block(h[lane], read_imm(blocks[lane], offset)); });
+                    }
+                }
+
+                detail::for_each_lane([&](const std::size_t lane) {
+                    const auto value = std::span(group[lane]);
+                    State state = {.h = h[lane], .length = value.size() * sizeof(CharTy)};
+                    std::size_t offset = common_size;
+                    for (; state.length - offset >= sizeof(Ty); offset += sizeof(Ty)) {
+                        mix_block(state.h, read_imm(value, offset));
+                    }
+                    for (; offset < state.length; ++offset, ++state.tail_size) {
+                        state.tail |= static_cast<Ty>(detail::read_byte(value, offset)) << (state.tail_size * CHAR_BIT);
+                    }
+                    out[i + lane] = finalize(state);
+                });
+            }
+
+            for (; i < values.size(); ++i) {
+                out[i] = hash_impl(std::span(values[i]));
+            }
+        }
+    };
+
+    /// \brief Murmur3 x64_128 hash function, processes the input in 16-byte blocks
+    /// \tparam Ty The size type for the hash, 64-bit hashes are the lower half of the 128-bit ones
+    /// \note Just like Murmur3, this implementation hashes the sequence of bytes
+    /// \see https://github.com/aappleby/smhasher/blob/master/src/MurmurHash3.cpp
+    template <detail::HashSize Ty = Hash128, std::uint64_t Seed = 0, typename Parameters = detail::Murmur128Parameters>
+        requires(traits::is_any_of_v<Ty, Hash128, std::uint64_t>)
+    class Murmur3x64 : public HashFunction<Murmur3x64<Ty, Seed, Parameters>, Ty> {
+        static constexpr std::size_t kBlockSize = 2 * sizeof(std::uint64_t);
+
+        [[nodiscard]] static constexpr std::uint64_t scramble_k1(std::uint64_t k1) noexcept {
+            k1 *= Parameters::c1;
+            k1 = std::rotl(k1, Parameters::k1_rot);
+            k1 *= Parameters::c2;
+            return k1;
+        }
+
+        [[nodiscard]] static constexpr std::uint64_t scramble_k2(std::uint64_t k2) noexcept {
+            k2 *= Parameters::c2;
+            k2 = std::rotl(k2, Parameters::k2_rot);
+            k2 *= Parameters::c1;
+            return k2;
+        }
+
+        [[nodiscard]] static constexpr std::uint64_t fmix(std::uint64_t k) noexcept {
+            k ^= k >> Parameters::fmix_shift;
+            k *= Parameters::fmix_c1;
+            k ^= k >> Parameters::fmix_shift;
+            k *= Parameters::fmix_c2;
+            k ^= k >> Parameters::fmix_shift;
+            return k;
+        }
+
+        static constexpr void mix_block(std::uint64_t& h1, std::uint64_t& h2, const std::uint64_t k1, const std::uint64_t k2) noexcept {
+            h1 ^= scramble_k1(k1);
+            h1 = std::rotl(h1, Parameters::h1_rot);
+            h1 += h2;
+            h1 = h1 * Parameters::m + Parameters::n1;
+
+            h2 ^= scramble_k2(k2);
+            h2 = std::rotl(h2, Parameters::h2_rot);
+            h2 += h1;
+            h2 = h2 * Parameters::m + Parameters::n2;
+        }
+
+    public:
+        /// \brief Streaming state, bytes that don't form a complete block yet are kept in `tail`
+        struct State {
+            std::uint64_t h1 = Seed;
+            std::uint64_t h2 = Seed;
+            std::array<std::uint64_t, 2> tail = {};
+            std::size_t tail_size = 0;
+            std::size_t length = 0;
+        };
+
+        [[nodiscard]] static constexpr State init() noexcept {
+            return {};
+        }
+
+        template <detail::Hashable CharTy>
+        static constexpr void update(State& state, const std::span<CharTy> value) noexcept {
+            const std::size_t len = value.size() * sizeof(CharTy);
+            std::size_t offset = 0;
+            state.length += len;
+
+            const auto push_tail = [&state](const std::uint8_t byte) constexpr {
+                state.tail.at(state.tail_size / sizeof(std::uint64_t)) |= static_cast<std::uint64_t>(byte)
+                                                                          << ((state.tail_size % sizeof(std::uint64_t)) * CHAR_BIT);
+                ++state.tail_size;
+            };
+
+            // Complete the block left over from the previous update first
+            if (state.tail_size != 0) {
+                for (; offset < len && state.tail_size < kBlockSize; ++offset) {
+                    push_tail(detail::read_byte(value, offset));
+                }
+                if (state.tail_size < kBlockSize) {
+                    return;
+                }
+
+                mix_block(state.h1, state.h2, state.tail[0], state.tail[1]);
+                state.tail = {};
+                state.tail_size = 0;
+            }
+
+            for (; len - offset >= kBlockSize; offset += kBlockSize) {
+                const auto k1 = detail::read_le<std::uint64_t>(value, offset);
+                const auto k2 = detail::read_le<std::uint64_t>(value, offset + sizeof(std::uint64_t));
+                mix_block(state.h1, state.h2, k1, k2);
+            }
+
+            for (; offset < len; ++offset) {
+                push_tail(detail::read_byte(value, offset));
+            }
+        }
+
+        [[nodiscard]] static constexpr Ty finalize(const State& state) noexcept {
+            auto h1 = state.h1;
+            auto h2 = state.h2;
+
+            if (state.tail_size > sizeof(std::uint64_t)) {
+                h2 ^= scramble_k2(state.tail[1]);
+            }
+            if (state.tail_size != 0) {
+                h1 ^= scramble_k1(state.tail[0]);
+            }
+
+            h1 ^= static_cast<std::uint64_t>(state.length);
+            h2 ^= static_cast<std::uint64_t>(state.length);
+
+            h1 += h2;
+            h2 += h1;
+
+            h1 = fmix(h1);
+            h2 = fmix(h2);
+
+            h1 += h2;
+            h2 += h1;
+
+            if constexpr (std::is_same_v<Ty, Hash128>) {
+                return Hash128{.low = h1, .high = h2};
+            } else {
+                return h1;
+            }
+        }
+
+        template <detail::Hashable CharTy>
+        [[nodiscard]] static constexpr Ty hash_impl(const std::span<CharTy> value) noexcept {
+            State state = init();
+            update(state, value);
+            return finalize(state);
+        }
     };
 
     using Murmur3_32 = Murmur3<std::uint32_t>;
+    using Murmur3_64 = Murmur3x64<std::uint64_t>;
+    using Murmur3_128 = Murmur3x64<Hash128>;
 } // namespace hashes
 
 [[nodiscard]] consteval std::uint32_t operator""_murmur3_32(const char* value, std::size_t size) noexcept {
     return hashes::Murmur3_32::hash(std::span(value, size));
 }
+
+[[nodiscard]] consteval std::uint64_t operator""_murmur3_64(const char* value, std::size_t size) noexcept {
+    return hashes::Murmur3_64::hash(std::span(value, size));
+}
+
+[[nodiscard]] consteval hashes::Hash128 operator""_murmur3_128(const char* value, std::size_t size) noexcept {
+    return hashes::Murmur3_128::hash(std::span(value, size));
+}
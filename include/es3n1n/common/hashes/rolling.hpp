@@ -0,0 +1,170 @@
+#pragma once
+#include "es3n1n/common/hashes/base.hpp"
+#include <array>
+#include <bit>
+#include <cassert>
+#include <climits>
+#include <concepts>
+
+namespace hashes {
+    namespace detail {
+        template <typename Ty> concept RollableByte = Hashable<Ty> && sizeof(Ty) == 1;
+
+        template <RollableByte CharTy>
+        [[nodiscard]] constexpr std::uint8_t to_byte(const CharTy value) noexcept {
+            return std::bit_cast<std::uint8_t>(value);
+        }
+    } // namespace detail
+
+    /// \brief Base class for rolling hash functions using CRTP
+    /// \tparam Derived The derived hash function class, it should provide `push`, `roll`, `value` and `reset`
+    /// \tparam Ty The size type for the hash
+    /// \note The hash of a window is updated in O(1) when it slides by a byte, instead of rehashing the whole window
+    template <typename Derived, std::unsigned_integral Ty>
+    class RollingHash {
+    public:
+        using ValueTy = Ty;
+
+        constexpr explicit RollingHash(const std::size_t window) noexcept: window_(window) {
+            assert(window > 0);
+        }
+
+        [[nodiscard]] constexpr std::size_t window() const noexcept {
+            return window_;
+        }
+
+        /// \brief Hash the bytes from scratch, hashing exactly `window()` bytes gives the same value as rolling over them
+        template <detail::RollableByte CharTy>
+        [[nodiscard]] constexpr Ty hash(const std::span<CharTy> value) const noexcept {
+            auto state = derived();
+            state.reset();
+            for (const auto c : value) {
+                state.push(detail::to_byte(c));
+            }
+            return state.value();
+        }
+
+        /// \brief Invoke the callback with the offset and the hash of every window of the data, in order
+        /// \note Nothing is invoked if the data is shorter than the window
+        template <detail::RollableByte CharTy, typename Fn>
+        constexpr void for_each_window(const std::span<CharTy> data, Fn&& fn) const {
+            if (data.size() < window_) {
+                return;
+            }
+
+            auto state = derived();
+            state.reset();
+            for (std::size_t i = 0; i < window_; ++i) {
+                state.push(detail::to_byte(data[i]));
+            }
+            fn(std::size_t{0}, state.value());
+
+            for (std::size_t offset = 1; offset + window_ <= data.size(); ++offset) {
+                state.roll(detail::to_byte(data[offset - 1]), detail::to_byte(data[offset + window_ - 1]));
+                fn(offset, state.value());
+            }
+        }
+
+        /// \brief Hash every window of the data, `out[i]` is set to the hash of `data.subspan(i, window())`
+        /// \return Amount of windows, `data.size() - window() + 1` or zero if the data is shorter than the window
+        template <detail::RollableByte CharTy>
+        constexpr std::size_t hash_windows(const std::span<CharTy> data, const std::span<Ty> out) const noexcept {
+            const std::size_t count = data.size() < window_ ? 0 : data.size() - window_ + 1;
+            assert(out.size() >= count);
+            for_each_window(data, [out](const std::size_t offset, const Ty hash) -> void { out[offset] = hash; });
+            return count;
+        }
+
+    private:
+        [[nodiscard]] constexpr const Derived& derived() const noexcept {
+            return static_cast<const Derived&>(*this);
+        }
+
+        std::size_t window_;
+    };
+
+    /// \brief Rabin-Karp polynomial rolling hash
+    /// \tparam Ty The size type for the hash, all arithmetic is modulo its range, so narrower types would be promoted to signed ints
+    /// \tparam Base The multiplier, should be odd
+    /// \note The hash of the bytes c_0..c_{n-1} is the sum of c_i * Base^(n-1-i)
+    /// \see https://en.wikipedia.org/wiki/Rabin%E2%80%93Karp_algorithm
+    template <std::unsigned_integral Ty = std::uint64_t, Ty Base = (sizeof(Ty) == 4 ? 0x01000193 : 0x00000100000001b3)>
+        requires(sizeof(Ty) >= sizeof(std::uint32_t) && Base % 2 == 1)
+    class RabinKarp : public RollingHash<RabinKarp<Ty, Base>, Ty> {
+    public:
+        constexpr explicit RabinKarp(const std::size_t window) noexcept: RollingHash<RabinKarp, Ty>(window) {
+            for (std::size_t i = 1; i < window; ++i) {
+                out_factor_ *= Base;
+            }
+        }
+
+        constexpr void reset() noexcept {
+            value_ = 0;
+        }
+
+        /// \brief Append a byte, used to fill the first window
+        constexpr void push(const std::uint8_t in) noexcept {
+            value_ = value_ * Base + in;
+        }
+
+        /// \brief Slide the window by a byte
+        constexpr void roll(const std::uint8_t out, const std::uint8_t in) noexcept {
+            value_ = (value_ - out * out_factor_) * Base + in;
+        }
+
+        [[nodiscard]] constexpr Ty value() const noexcept {
+            return value_;
+        }
+
+    private:
+        Ty out_factor_ = 1;
+        Ty value_ = 0;
+    };
+
+    /// \brief Buzhash (cyclic polynomial) rolling hash
+    /// \tparam Ty The size type for the hash
+    /// \note Bytes are mapped to random values that are rotated and xored, there are no multiplications
+    /// \see https://en.wikipedia.org/wiki/Rolling_hash#Cyclic_polynomial
+    template <std::unsigned_integral Ty = std::uint64_t>
+    class Buzhash : public RollingHash<Buzhash<Ty>, Ty> {
+        static constexpr std::size_t kBits = sizeof(Ty) * CHAR_BIT;
+
+        /// \brief Random values of the bytes, generated with splitmix64
+        static constexpr auto kTable = []() -> std::array<Ty, 0x100> {
+            std::array<Ty, 0x100> result = {};
+            std::uint64_t state = 0;
+            for (auto& value : result) {
+                state += 0x9e3779b97f4a7c15ULL;
+                auto mixed = (state ^ (state >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+                mixed = (mixed ^ (mixed >> 27U)) * 0x94d049bb133111ebULL;
+                value = static_cast<Ty>(mixed ^ (mixed >> 31U));
+            }
+            return result;
+        }();
+
+    public:
+        constexpr explicit Buzhash(const std::size_t window) noexcept: RollingHash<Buzhash, Ty>(window), out_rotation_(static_cast<int>(window % kBits)) { }
+
+        constexpr void reset() noexcept {
+            value_ = 0;
+        }
+
+        /// \brief Append a byte, used to fill the first window
+        constexpr void push(const std::uint8_t in) noexcept {
+            value_ = std::rotl(value_, 1) ^ kTable[in];
+        }
+
+        /// \brief Slide the window by a byte
+        constexpr void roll(const std::uint8_t out, const std::uint8_t in) noexcept {
+            value_ = std::rotl(value_, 1) ^ std::rotl(kTable[out], out_rotation_) ^ kTable[in];
+        }
+
+        [[nodiscard]] constexpr Ty value() const noexcept {
+            return value_;
+        }
+
+    private:
+        int out_rotation_;
+        Ty value_ = 0;
+    };
+} // namespace hashes
@@ -0,0 +1,112 @@
+#pragma once
+#include "es3n1n/common/hashes/base.hpp"
+#include <bit>
+#include <climits>
+#include <random>
+
+namespace hashes {
+    /// \brief 128-bit SipHash key
+    struct SipHashKey {
+        std::uint64_t k0 = 0;
+        std::uint64_t k1 = 0;
+
+        constexpr bool operator==(const SipHashKey& other) const noexcept = default;
+
+        /// \brief Generate a key from the non-deterministic random device
+        [[nodiscard]] static SipHashKey random() {
+            std::random_device device;
+            const auto next = [&device]() -> std::uint64_t {
+                return (static_cast<std::uint64_t>(device()) << (sizeof(std::uint32_t) * CHAR_BIT)) | device();
+            };
+            return {.k0 = next(), .k1 = next()};
+        }
+    };
+
+    /// \brief SipHash keyed hash function, resistant to hash flooding as long as the key is kept secret
+    /// \tparam CRounds The amount of rounds per message block
+    /// \tparam DRounds The amount of finalization rounds
+    /// \note Wide characters are hashed as their little-endian bytes, just like murmur3
+    /// \see https://www.aumasson.jp/siphash/siphash.pdf
+    template <std::size_t CRounds, std::size_t DRounds>
+        requires(CRounds > 0 && DRounds > 0)
+    class SipHash : public KeyedHashFunction<SipHash<CRounds, DRounds>, std::uint64_t> {
+        struct State {
+            std::uint64_t v0;
+            std::uint64_t v1;
+            std::uint64_t v2;
+            std::uint64_t v3;
+        };
+
+    public:
+        using Key = SipHashKey;
+
+        /// \brief Construct with a random key, every instance hashes differently
+        SipHash(): SipHash(Key::random()) { }
+
+        constexpr explicit SipHash(const Key key) noexcept: key_(key) { }
+
+        [[nodiscard]] constexpr const Key& key() const noexcept {
+            return key_;
+        }
+
+        template <detail::Hashable CharTy>
+        [[nodiscard]] constexpr std::uint64_t hash_impl(const std::span<CharTy> value) const noexcept {
+            State state = {
+                .v0 = key_.k0 ^ 0x736f6d6570736575ULL,
+                .v1 = key_.k1 ^ 0x646f72616e646f6dULL,
+                .v2 = key_.k0 ^ 0x6c7967656e657261ULL,
+                .v3 = key_.k1 ^ 0x7465646279746573ULL,
+            };
+
+            const std::size_t size = value.size_bytes();
+            const std::size_t blocks_end = size & ~std::size_t{7};
+            for (std::size_t offset = 0; offset < blocks_end; offset += sizeof(std::uint64_t)) {
+                compress(state, detail::read_le<std::uint64_t>(value, offset));
+            }
+
+            auto last = static_cast<std::uint64_t>(size) << 56U;
+            for (std::size_t i = 0; i < size - blocks_end; ++i) {
+                last |= static_cast<std::uint64_t>(detail::read_byte(value, blocks_end + i)) << (i * CHAR_BIT);
+            }
+            compress(state, last);
+
+            state.v2 ^= 0xFFU;
+            rounds<DRounds>(state);
+            return state.v0 ^ state.v1 ^ state.v2 ^ state.v3;
+        }
+
+    private:
+        static constexpr void compress(State& state, const std::uint64_t block) noexcept {
+            state.v3 ^= block;
+            rounds<CRounds>(state);
+            state.v0 ^= block;
+        }
+
+        template <std::size_t Count>
+        static constexpr void rounds(State& state) noexcept {
+            for (std::size_t i = 0; i < Count; ++i) {
+                state.v0 += state.v1;
+                state.v1 = std::rotl(state.v1, 13);
+                state.v1 ^= state.v0;
+                state.v0 = std::rotl(state.v0, 32);
+                state.v2 += state.v3;
+                state.v3 = std::rotl(state.v3, 16);
+                state.v3 ^= state.v2;
+                state.v0 += state.v3;
+                state.v3 = std::rotl(state.v3, 21);
+                state.v3 ^= state.v0;
+                state.v2 += state.v1;
+                state.v1 = std::rotl(state.v1, 17);
+                state.v1 ^= state.v2;
+                state.v2 = std::rotl(state.v2, 32);
+            }
+        }
+
+        Key key_;
+    };
+
+    /// \brief The faster variant, used by CPython and Rust hash tables
+    using SipHash13 = SipHash<1, 3>;
+    /// \brief The original, more conservative variant
+    using SipHash24 = SipHash<2, 4>;
+} // namespace hashes
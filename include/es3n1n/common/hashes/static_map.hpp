@@ -0,0 +1,194 @@
+#pragma once
+#include "es3n1n/common/hashes/base.hpp"
+#include "es3n1n/common/types.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace hashes {
+    namespace detail {
+        /// \brief Scramble the key hash with a seed, keys that share a bucket are moved apart by picking a different seed
+        /// \see https://prng.di.unimi.it/splitmix64.c
+        [[nodiscard]] constexpr std::uint64_t perfect_hash_mix(const std::uint64_t hash, const std::uint64_t seed) noexcept {
+            auto result = hash + (seed + 1) * 0x9e3779b97f4a7c15ULL;
+            result = (result ^ (result >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+            result = (result ^ (result >> 27U)) * 0x94d049bb133111ebULL;
+            return result ^ (result >> 31U);
+        }
+
+        /// \brief Maximum amount of seeds that are tried for a single bucket before giving up
+        inline constexpr std::uint32_t kPerfectHashMaxSeed = 1U << 16U;
+    } // namespace detail
+
+    /// \brief Immutable string-keyed map with a collision-free table built at compile time
+    /// \tparam Hash The hash function used for the keys
+    /// \tparam ValueTy The mapped type
+    /// \tparam N The amount of entries
+    /// \note Keys are hashed into buckets, every bucket gets a seed that places all of its keys into free slots (hash and displace).
+    ///     A lookup is a single hash of the key, then exactly one key comparison. Free slots hold a copy of the first entry,
+    ///     it is never reachable by its own key so the comparison rejects it.
+    /// \note Keys are stored as string views, they should point to string literals or other static storage
+    template <typename Hash, typename ValueTy, std::size_t N>
+        requires(N > 0 && std::unsigned_integral<decltype(Hash::hash(std::string_view{}))>)
+    class StaticMap {
+    public:
+        using HashTy = decltype(Hash::hash(std::string_view{}));
+        using Entry = std::pair<std::string_view, ValueTy>;
+
+        static constexpr std::size_t kSlots = std::bit_ceil(N);
+        static constexpr std::size_t kBuckets = std::bit_ceil((N + 1) / 2);
+
+        consteval explicit StaticMap(const std::array<Entry, N>& entries) {
+            std::array<HashTy, N> hashes = {};
+            std::array<std::size_t, N> order = {};
+            for (std::size_t i = 0; i < N; ++i) {
+                hashes[i] = Hash::hash(entries[i].first);
+                order[i] = i;
+            }
+
+            // Equal keys have equal hashes, so sorting by hash is enough to find both the duplicates and the collisions
+            std::ranges::sort(order, [&](const std::size_t lhs, const std::size_t rhs) { return hashes[lhs] < hashes[rhs]; });
+            for (std::size_t i = 1; i < N; ++i) {
+                if (hashes[order[i - 1]] != hashes[order[i]]) {
+                    continue;
+                }
+                if (entries[order[i - 1]].first == entries[order[i]].first) {
+                    throw std::invalid_argument("StaticMap: duplicate key");
+                }
+                throw std::invalid_argument("StaticMap: hash collision, use a wider hash function");
+            }
+
+            // Place the largest buckets first, while there are plenty of free slots
+            std::array<std::size_t, kBuckets> bucket_sizes = {};
+            for (std::size_t i = 0; i < N; ++i) {
+                ++bucket_sizes[bucket(hashes[i])];
+            }
+            std::ranges::sort(order, [&](const std::size_t lhs, const std::size_t rhs) {
+                const auto lhs_bucket = bucket(hashes[lhs]);
+                const auto rhs_bucket = bucket(hashes[rhs]);
+                if (bucket_sizes[lhs_bucket] != bucket_sizes[rhs_bucket]) {
+                    return bucket_sizes[lhs_bucket] > bucket_sizes[rhs_bucket];
+                }
+                return lhs_bucket < rhs_bucket;
+            });
+
+            std::array<bool, kSlots> occupied = {};
+            for (std::size_t first = 0; first < N;) {
+                const auto current_bucket = bucket(hashes[order[first]]);
+                const auto members = std::span(order).subspan(first, bucket_sizes[current_bucket]);
+                seeds_[current_bucket] = find_seed(hashes, members, occupied);
+
+                for (const auto index : members) {
+                    const auto index_slot = slot(hashes[index], seeds_[current_bucket]);
+                    occupied[index_slot] = true;
+                    slots_[index_slot] = entries[index];
+                    hashes_[index_slot] = hashes[index];
+                }
+                first += members.size();
+            }
+
+            for (std::size_t i = 0; i < kSlots; ++i) {
+                if (!occupied[i]) {
+                    slots_[i] = entries[0];
+                    hashes_[i] = hashes[0];
+                }
+            }
+        }
+
+        /// \brief Find the value mapped to the key
+        /// \return Pointer to the value, nullptr if there's no such key
+        [[nodiscard]] constexpr const ValueTy* find(const std::string_view key) const noexcept {
+            const auto& entry = slots_[lookup(Hash::hash(key))];
+            return entry.first == key ? &entry.second : nullptr;
+        }
+
+        /// \brief Find the value by the key hash only, no strings are compared
+        /// \note Only hashes of the keys are guaranteed to be unique, any other hash can match a key
+        [[nodiscard]] constexpr const ValueTy* find_by_hash(const HashTy hash) const noexcept {
+            const auto index = lookup(hash);
+            return hashes_[index] == hash ? &slots_[index].second : nullptr;
+        }
+
+        [[nodiscard]] constexpr bool contains(const std::string_view key) const noexcept {
+            return find(key) != nullptr;
+        }
+
+        /// \throws std::out_of_range if there's no such key
+        [[nodiscard]] constexpr const ValueTy& at(const std::string_view key) const {
+            const auto* result = find(key);
+            if (result == nullptr) {
+                throw std::out_of_range("StaticMap: key not found");
+            }
+            return *result;
+        }
+
+        /// \brief Get the value of a compile-time key, the key is hashed at compile time
+        /// \throws std::out_of_range if there's no such key
+        template <types::CtString Key>
+        [[nodiscard]] constexpr const ValueTy& at() const {
+            constexpr std::string_view kKey = {Key.data.data(), Key.size()};
+            constexpr HashTy kHash = Hash::hash(kKey);
+
+            const auto& entry = slots_[lookup(kHash)];
+            if (entry.first != kKey) {
+                throw std::out_of_range("StaticMap: key not found");
+            }
+            return entry.second;
+        }
+
+        [[nodiscard]] static constexpr std::size_t size() noexcept {
+            return N;
+        }
+
+    private:
+        /// \note Buckets use a seed that is never tried for the slots, so that both mixes are independent
+        [[nodiscard]] static constexpr std::size_t bucket(const HashTy hash) noexcept {
+            return static_cast<std::size_t>(detail::perfect_hash_mix(hash, detail::kPerfectHashMaxSeed) & (kBuckets - 1));
+        }
+
+        [[nodiscard]] static constexpr std::size_t slot(const HashTy hash, const std::uint32_t seed) noexcept {
+            return static_cast<std::size_t>(detail::perfect_hash_mix(hash, seed) & (kSlots - 1));
+        }
+
+        [[nodiscard]] constexpr std::size_t lookup(const HashTy hash) const noexcept {
+            return slot(hash, seeds_[bucket(hash)]);
+        }
+
+        /// \brief Find a seed that places every member of the bucket into a distinct free slot
+        [[nodiscard]] static consteval std::uint32_t find_seed(const std::array<HashTy, N>& hashes, const std::span<const std::size_t> members,
+                                                               const std::array<bool, kSlots>& occupied) {
+            for (std::uint32_t seed = 0; seed < detail::kPerfectHashMaxSeed; ++seed) {
+                bool ok = true;
+                for (std::size_t i = 0; ok && i < members.size(); ++i) {
+                    const auto member_slot = slot(hashes[members[i]], seed);
+                    ok = !occupied[member_slot];
+                    for (std::size_t j = 0; ok && j < i; ++j) {
+                        ok = slot(hashes[members[j]], seed) != member_slot;
+                    }
+                }
+
+                if (ok) {
+                    return seed;
+                }
+            }
+            throw std::invalid_argument("StaticMap: unable to find a seed for a bucket");
+        }
+
+        std::array<std::uint32_t, kBuckets> seeds_ = {};
+        std::array<Entry, kSlots> slots_ = {};
+        std::array<HashTy, kSlots> hashes_ = {};
+    };
+
+    /// \brief Build a StaticMap at compile time
+    /// \code
+    /// constexpr auto kMap = hashes::make_static_map<hashes::Fnv1a_32, int>({{"foo", 1}, {"bar", 2}});
+    /// static_assert(kMap.at<"bar">() == 2);
+    /// \endcode
+    template <typename Hash, typename ValueTy, std::size_t N>
+    [[nodiscard]] consteval auto make_static_map(const std::pair<std::string_view, ValueTy> (&entries)[N]) {
+        return StaticMap<Hash, ValueTy, N>(std::to_array(entries));
+    }
+} // namespace hashes
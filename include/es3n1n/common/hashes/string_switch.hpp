@@ -0,0 +1,120 @@
+#pragma once
+#include "es3n1n/common/hashes/base.hpp"
+#include "es3n1n/common/types.hpp"
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <string_view>
+
+namespace hashes {
+    /// \brief Switch over a runtime string using hashes of compile-time labels
+    /// \tparam Hash The hash function used for the labels
+    /// \tparam Labels The labels, their hashes should be unique
+    /// \note The string is hashed once and its hash is switched over. A label hash is returned only if the string is equal
+    ///     to the label, so colliding strings fall through to `default`. Duplicate labels and hash collisions between the
+    ///     labels are compile-time errors
+    /// \note Use `label<"...">` for the cases, it fails to compile if the string isn't one of the labels. A raw literal such
+    ///     as `case "quit"_fnv1a_32:` isn't checked, a typo in it compiles into a case that never matches. Check such
+    ///     literals with `static_assert(Command::has_label<"quit">)`
+    /// \code
+    /// using Command = hashes::StringSwitch<hashes::Fnv1a_32, "help", "quit">;
+    /// switch (Command::match(input)) {
+    /// case Command::label<"help">:
+    ///     break;
+    /// case Command::label<"quit">:
+    ///     break;
+    /// default:
+    ///     break;
+    /// }
+    /// \endcode
+    template <typename Hash, types::CtString... Labels>
+        requires(sizeof...(Labels) > 0 && std::unsigned_integral<decltype(Hash::hash(std::string_view{}))>)
+    class StringSwitch {
+    public:
+        using HashTy = decltype(Hash::hash(std::string_view{}));
+
+    private:
+        static constexpr std::size_t kCount = sizeof...(Labels);
+        static constexpr std::array<std::string_view, kCount> kStrings = {std::string_view{Labels.data.data(), Labels.size()}...};
+        static constexpr std::array<HashTy, kCount> kHashes = {Hash::hash(std::string_view{Labels.data.data(), Labels.size()})...};
+
+        [[nodiscard]] static consteval bool validate() {
+            for (std::size_t i = 0; i < kCount; ++i) {
+                for (std::size_t j = 0; j < i; ++j) {
+                    if (kHashes[i] != kHashes[j]) {
+                        continue;
+                    }
+                    if (kStrings[i] == kStrings[j]) {
+                        throw std::invalid_argument("StringSwitch: duplicate label");
+                    }
+                    throw std::invalid_argument("StringSwitch: hash collision, use a wider hash function");
+                }
+            }
+            return true;
+        }
+        static_assert(validate());
+
+        /// \brief Label indices ordered by their hashes, so that `match` can binary search them
+        static constexpr std::array<std::size_t, kCount> kOrder = []() {
+            std::array<std::size_t, kCount> result = {};
+            for (std::size_t i = 0; i < kCount; ++i) {
+                result[i] = i;
+            }
+            std::ranges::sort(result, {}, [](const std::size_t index) { return kHashes[index]; });
+            return result;
+        }();
+        static constexpr std::array<HashTy, kCount> kSortedHashes = []() {
+            std::array<HashTy, kCount> result = {};
+            std::ranges::transform(kOrder, result.begin(), [](const std::size_t index) { return kHashes[index]; });
+            return result;
+        }();
+        static constexpr std::array<std::string_view, kCount> kSortedStrings = []() {
+            std::array<std::string_view, kCount> result = {};
+            std::ranges::transform(kOrder, result.begin(), [](const std::size_t index) { return kStrings[index]; });
+            return result;
+        }();
+
+        template <types::CtString Label>
+        [[nodiscard]] static consteval std::size_t index_of() {
+            const auto* it = std::ranges::find(kStrings, std::string_view{Label.data.data(), Label.size()});
+            if (it == kStrings.end()) {
+                throw std::invalid_argument("StringSwitch: unknown label");
+            }
+            return static_cast<std::size_t>(it - kStrings.begin());
+        }
+
+    public:
+        /// \brief The value returned for strings that are not labels, it is not equal to any label hash
+        static constexpr HashTy kNoMatch = []() -> HashTy {
+            HashTy result = 0;
+            while (std::ranges::find(kHashes, result) != kHashes.end()) {
+                ++result;
+            }
+            return result;
+        }();
+
+        /// \brief Whether the string is one of the labels
+        template <types::CtString Label>
+        static constexpr bool has_label = std::ranges::find(kStrings, std::string_view{Label.data.data(), Label.size()}) != kStrings.end();
+
+        /// \brief Case label of the string, the string should be one of the labels
+        template <types::CtString Label>
+            requires has_label<Label>
+        static constexpr typename Hash::Value label = kHashes[index_of<Label>()];
+
+        /// \brief Hash the string for the switch
+        /// \return Hash of the label that is equal to the string, `kNoMatch` if there's no such label
+        [[nodiscard]] static constexpr HashTy match(const std::string_view value) noexcept {
+            const auto hash = Hash::hash(value);
+            const auto* it = std::ranges::lower_bound(kSortedHashes, hash);
+            if (it == kSortedHashes.end() || *it != hash) {
+                return kNoMatch;
+            }
+            return kSortedStrings[static_cast<std::size_t>(it - kSortedHashes.begin())] == value ? hash : kNoMatch;
+        }
+
+        [[nodiscard]] static constexpr std::size_t size() noexcept {
+            return kCount;
+        }
+    };
+} // namespace hashes
@@ -0,0 +1,48 @@
+#pragma once
+#include "es3n1n/common/hashes/base.hpp"
+#include "es3n1n/common/hashes/fnv.hpp"
+#include "es3n1n/common/hashes/murmur.hpp"
+#include "es3n1n/common/hashes/siphash.hpp"
+#include "es3n1n/common/hashes/xxhash.hpp"
+
+namespace hashes {
+    /// \brief Hasher functor for unordered containers with heterogeneous lookup
+    /// \tparam Hash The hash function, either a HashFunction or a KeyedHashFunction
+    /// \tparam CharTy The character type of the keys
+    /// \note Paired with `std::equal_to<>`, lookups by a string view or a literal don't construct a temporary key:
+    /// \code
+    /// std::unordered_map<std::string, int, hashes::Fnv1aHasher, std::equal_to<>> map;
+    /// map.find(std::string_view{"foo"});
+    /// \endcode
+    template <typename Hash, detail::Hashable CharTy = char>
+        requires std::unsigned_integral<decltype(Hash{}.hash(std::basic_string_view<CharTy>{}))>
+    class TransparentHasher {
+    public:
+        using is_transparent = void;
+
+        TransparentHasher() = default;
+
+        /// \brief Use the specified instance of the hash function, e.g. a keyed one
+        constexpr explicit TransparentHasher(const Hash& hash) noexcept: hash_(hash) { }
+
+        [[nodiscard]] constexpr std::size_t operator()(const std::basic_string_view<CharTy> value) const noexcept {
+            return static_cast<std::size_t>(hash_.hash(value));
+        }
+
+        [[nodiscard]] constexpr std::size_t operator()(const std::basic_string<CharTy>& value) const noexcept {
+            return (*this)(std::basic_string_view<CharTy>(value));
+        }
+
+        [[nodiscard]] constexpr std::size_t operator()(const CharTy* value) const noexcept {
+            return (*this)(std::basic_string_view<CharTy>(value));
+        }
+
+    private:
+        [[no_unique_address]] Hash hash_ = {};
+    };
+
+    using Fnv1aHasher = TransparentHasher<Fnv1a<std::size_t>>;
+    using Murmur3Hasher = TransparentHasher<Murmur3_64>;
+    using Xxh3Hasher = TransparentHasher<Xxh3_64>;
+    using SipHash13Hasher = TransparentHasher<SipHash13>;
+} // namespace hashes
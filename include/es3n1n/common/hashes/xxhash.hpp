@@ -0,0 +1,398 @@
+#pragma once
+#include "es3n1n/common/cpu.hpp"
+#include "es3n1n/common/hashes/base.hpp"
+#include <array>
+#include <bit>
+
+#if PLATFORM_IS_X86
+    #include <immintrin.h>
+#endif
+
+namespace hashes {
+    namespace detail {
+        struct Xxh3Parameters {
+            static constexpr std::uint32_t prime32_1 = 0x9E3779B1U;
+            static constexpr std::uint32_t prime32_2 = 0x85EBCA77U;
+            static constexpr std::uint32_t prime32_3 = 0xC2B2AE3DU;
+
+            static constexpr std::uint64_t prime64_1 = 0x9E3779B185EBCA87ULL;
+            static constexpr std::uint64_t prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+            static constexpr std::uint64_t prime64_3 = 0x165667B19E3779F9ULL;
+            static constexpr std::uint64_t prime64_4 = 0x85EBCA77C2B2AE63ULL;
+            static constexpr std::uint64_t prime64_5 = 0x27D4EB2F165667C5ULL;
+
+            static constexpr std::uint64_t prime_mx1 = 0x165667919E3779F9ULL;
+            static constexpr std::uint64_t prime_mx2 = 0x9FB21C651E98DF25ULL;
+
+            static constexpr std::size_t stripe_len = 64;
+            static constexpr std::size_t secret_consume_rate = 8;
+            static constexpr std::size_t secret_lastacc_start = 7;
+            static constexpr std::size_t secret_mergeaccs_start = 11;
+            static constexpr std::size_t secret_size_min = 136;
+
+            static constexpr std::size_t midsize_max = 240;
+            static constexpr std::size_t midsize_startoffset = 3;
+            static constexpr std::size_t midsize_lastoffset = 17;
+
+            /// \brief Pseudorandom secret taken directly from FARSH
+            static constexpr std::array<std::uint8_t, 192> secret = {
+                0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c, //
+                0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f, //
+                0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21, //
+                0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c, //
+                0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3, //
+                0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8, //
+                0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d, //
+                0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64, //
+                0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb, //
+                0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e, //
+                0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce, //
+                0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e, //
+            };
+        };
+
+        using Xxh3Secret = std::array<std::uint8_t, Xxh3Parameters::secret.size()>;
+        using Xxh3Accumulators = std::array<std::uint64_t, Xxh3Parameters::stripe_len / sizeof(std::uint64_t)>;
+
+        /// \brief Multiply two 64-bit integers into 128 bits, then xor the halves
+        [[nodiscard]] constexpr std::uint64_t mul128_fold64(const std::uint64_t lhs, const std::uint64_t rhs) noexcept {
+#if defined(__SIZEOF_INT128__)
+            __extension__ using Uint128 = unsigned __int128;
+            const auto product = static_cast<Uint128>(lhs) * rhs;
+            return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64U);
+#else
+            constexpr std::uint64_t kMask = 0xFFFFFFFFULL;
+            const std::uint64_t lo_lo = (lhs & kMask) * (rhs & kMask);
+            const std::uint64_t hi_lo = (lhs >> 32U) * (rhs & kMask);
+            const std::uint64_t lo_hi = (lhs & kMask) * (rhs >> 32U);
+            const std::uint64_t hi_hi = (lhs >> 32U) * (rhs >> 32U);
+
+            const std::uint64_t cross = (lo_lo >> 32U) + (hi_lo & kMask) + lo_hi;
+            const std::uint64_t upper = (hi_lo >> 32U) + (cross >> 32U) + hi_hi;
+            const std::uint64_t lower = (cross << 32U) | (lo_lo & kMask);
+            return lower ^ upper;
+#endif
+        }
+
+#if PLATFORM_IS_X86
+        COMMON_TARGET("avx2") inline __m256i xxh3_round_avx2(const __m256i acc, const std::uint8_t* input, const std::uint8_t* secret) noexcept {
+            const auto data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input));
+            const auto key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret));
+            const auto data_key = _mm256_xor_si256(data, key);
+            const auto product = _mm256_mul_epu32(data_key, _mm256_srli_epi64(data_key, 32));
+            const auto swapped = _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            return _mm256_add_epi64(product, _mm256_add_epi64(acc, swapped));
+        }
+
+        COMMON_TARGET("avx2") inline __m256i xxh3_scramble_avx2(const __m256i acc, const std::uint8_t* secret) noexcept {
+            const auto prime = _mm256_set1_epi32(static_cast<int>(Xxh3Parameters::prime32_1));
+            const auto key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret));
+            const auto data_key = _mm256_xor_si256(_mm256_xor_si256(acc, _mm256_srli_epi64(acc, 47)), key);
+            const auto product_lo = _mm256_mul_epu32(data_key, prime);
+            const auto product_hi = _mm256_mul_epu32(_mm256_srli_epi64(data_key, 32), prime);
+            return _mm256_add_epi64(product_lo, _mm256_slli_epi64(product_hi, 32));
+        }
+
+        /// \brief Accumulate the stripes, optionally followed by a scramble, with 256-bit vectors
+        COMMON_TARGET("avx2")
+        inline void xxh3_accumulate_avx2(Xxh3Accumulators& acc, const std::uint8_t* input, const std::uint8_t* secret, const std::size_t stripes,
+                                         const std::uint8_t* scramble_secret) noexcept {
+            constexpr std::size_t kLanes = sizeof(__m256i) / sizeof(std::uint64_t);
+            auto acc0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc.data()));
+            auto acc1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc.data() + kLanes));
+
+            for (std::size_t n = 0; n < stripes; ++n) {
+                const auto* in = input + n * Xxh3Parameters::stripe_len;
+                const auto* key = secret + n * Xxh3Parameters::secret_consume_rate;
+                acc0 = xxh3_round_avx2(acc0, in, key);
+                acc1 = xxh3_round_avx2(acc1, in + sizeof(__m256i), key + sizeof(__m256i));
+            }
+
+            if (scramble_secret != nullptr) {
+                acc0 = xxh3_scramble_avx2(acc0, scramble_secret);
+                acc1 = xxh3_scramble_avx2(acc1, scramble_secret + sizeof(__m256i));
+            }
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc.data()), acc0);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc.data() + kLanes), acc1);
+        }
+
+        COMMON_TARGET("sse2") inline __m128i xxh3_round_sse2(const __m128i acc, const std::uint8_t* input, const std::uint8_t* secret) noexcept {
+            const auto data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+            const auto key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret));
+            const auto data_key = _mm_xor_si128(data, key);
+            const auto product = _mm_mul_epu32(data_key, _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1)));
+            const auto swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            return _mm_add_epi64(product, _mm_add_epi64(acc, swapped));
+        }
+
+        COMMON_TARGET("sse2") inline __m128i xxh3_scramble_sse2(const __m128i acc, const std::uint8_t* secret) noexcept {
+            const auto prime = _mm_set1_epi32(static_cast<int>(Xxh3Parameters::prime32_1));
+            const auto key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret));
+            const auto data_key = _mm_xor_si128(_mm_xor_si128(acc, _mm_srli_epi64(acc, 47)), key);
+            const auto product_lo = _mm_mul_epu32(data_key, prime);
+            const auto product_hi = _mm_mul_epu32(_mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+            return _mm_add_epi64(product_lo, _mm_slli_epi64(product_hi, 32));
+        }
+
+        /// \brief Accumulate the stripes, optionally followed by a scramble, with 128-bit vectors
+        COMMON_TARGET("sse2")
+        inline void xxh3_accumulate_sse2(Xxh3Accumulators& acc, const std::uint8_t* input, const std::uint8_t* secret, const std::size_t stripes,
+                                         const std::uint8_t* scramble_secret) noexcept {
+            constexpr std::size_t kLanes = sizeof(__m128i) / sizeof(std::uint64_t);
+            auto acc0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc.data()));
+            auto acc1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc.data() + kLanes));
+            auto acc2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc.data() + 2 * kLanes));
+            auto acc3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc.data() + 3 * kLanes));
+
+            for (std::size_t n = 0; n < stripes; ++n) {
+                const auto* in = input + n * Xxh3Parameters::stripe_len;
+                const auto* key = secret + n * Xxh3Parameters::secret_consume_rate;
+                acc0 = xxh3_round_sse2(acc0, in, key);
+                acc1 = xxh3_round_sse2(acc1, in + sizeof(__m128i), key + sizeof(__m128i));
+                acc2 = xxh3_round_sse2(acc2, in + 2 * sizeof(__m128i), key + 2 * sizeof(__m128i));
+                acc3 = xxh3_round_sse2(acc3, in + 3 * sizeof(__m128i), key + 3 * sizeof(__m128i));
+            }
+
+            if (scramble_secret != nullptr) {
+                acc0 = xxh3_scramble_sse2(acc0, scramble_secret);
+                acc1 = xxh3_scramble_sse2(acc1, scramble_secret + sizeof(__m128i));
+                acc2 = xxh3_scramble_sse2(acc2, scramble_secret + 2 * sizeof(__m128i));
+                acc3 = xxh3_scramble_sse2(acc3, scramble_secret + 3 * sizeof(__m128i));
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(acc.data()), acc0);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(acc.data() + kLanes), acc1);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(acc.data() + 2 * kLanes), acc2);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(acc.data() + 3 * kLanes), acc3);
+        }
+#endif
+    } // namespace detail
+
+    /// \brief XXH3 64-bit hash function
+    /// \tparam Ty The size type for the hash
+    /// \tparam Seed The hash seed
+    /// \note Just like Murmur3, this implementation hashes the sequence of bytes
+    /// \note Inputs longer than 240 bytes are accumulated with AVX2/SSE2 at runtime, when available
+    /// \see https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+    template <detail::HashSize Ty = std::uint64_t, std::uint64_t Seed = 0, typename Parameters = detail::Xxh3Parameters>
+        requires(std::is_same_v<Ty, std::uint64_t>)
+    class Xxh3 : public HashFunction<Xxh3<Ty, Seed, Parameters>, Ty> {
+        /// \brief Secret used for the long inputs, derived from the default one and the seed
+        static constexpr detail::Xxh3Secret kLongSecret = []() -> detail::Xxh3Secret {
+            detail::Xxh3Secret result = {};
+            for (std::size_t i = 0; i < result.size(); i += 2 * sizeof(std::uint64_t)) {
+                const auto lo = detail::read_le<std::uint64_t>(std::span<const std::uint8_t>(Parameters::secret), i) + Seed;
+                const auto hi = detail::read_le<std::uint64_t>(std::span<const std::uint8_t>(Parameters::secret), i + sizeof(std::uint64_t)) - Seed;
+                for (std::size_t j = 0; j < sizeof(std::uint64_t); ++j) {
+                    result.at(i + j) = static_cast<std::uint8_t>(lo >> (j * CHAR_BIT));
+                    result.at(i + sizeof(std::uint64_t) + j) = static_cast<std::uint8_t>(hi >> (j * CHAR_BIT));
+                }
+            }
+            return result;
+        }();
+
+        [[nodiscard]] static constexpr std::uint64_t secret64(const std::size_t offset) noexcept {
+            return detail::read_le<std::uint64_t>(std::span<const std::uint8_t>(Parameters::secret), offset);
+        }
+
+        [[nodiscard]] static constexpr std::uint32_t secret32(const std::size_t offset) noexcept {
+            return detail::read_le<std::uint32_t>(std::span<const std::uint8_t>(Parameters::secret), offset);
+        }
+
+        [[nodiscard]] static constexpr std::uint64_t xorshift64(const std::uint64_t value, const int shift) noexcept {
+            return value ^ (value >> shift);
+        }
+
+        [[nodiscard]] static constexpr std::uint64_t avalanche(std::uint64_t h) noexcept {
+            h = xorshift64(h, 37);
+            h *= Parameters::prime_mx1;
+            return xorshift64(h, 32);
+        }
+
+        [[nodiscard]] static constexpr std::uint64_t avalanche_xxh64(std::uint64_t h) noexcept {
+            h = xorshift64(h, 33);
+            h *= Parameters::prime64_2;
+            h = xorshift64(h, 29);
+            h *= Parameters::prime64_3;
+            return xorshift64(h, 32);
+        }
+
+        [[nodiscard]] static constexpr std::uint64_t rrmxmx(std::uint64_t h, const std::uint64_t len) noexcept {
+            h ^= std::rotl(h, 49) ^ std::rotl(h, 24);
+            h *= Parameters::prime_mx2;
+            h ^= (h >> 35U) + len;
+            h *= Parameters::prime_mx2;
+            return xorshift64(h, 28);
+        }
+
+        template <detail::Hashable CharTy>
+        [[nodiscard]] static constexpr std::uint64_t mix16(const std::span<CharTy>& value, const std::size_t offset,
+                                                           const std::size_t secret_offset) noexcept {
+            const auto lo = detail::read_le<std::uint64_t>(value, offset);
+            const auto hi = detail::read_le<std::uint64_t>(value, offset + sizeof(std::uint64_t));
+            return detail::mul128_fold64(lo ^ (secret64(secret_offset) + Seed), hi ^ (secret64(secret_offset + sizeof(std::uint64_t)) - Seed));
+        }
+
+        template <detail::Hashable CharTy>
+        [[nodiscard]] static constexpr std::uint64_t hash_0to16(const std::span<CharTy>& value, const std::size_t len) noexcept {
+            if (len > 8) {
+                const auto bitflip1 = (secret64(24) ^ secret64(32)) + Seed;
+                const auto bitflip2 = (secret64(40) ^ secret64(48)) - Seed;
+                const auto input_lo = detail::read_le<std::uint64_t>(value, 0) ^ bitflip1;
+                const auto input_hi = detail::read_le<std::uint64_t>(value, len - 8) ^ bitflip2;
+                const auto acc = len + std::byteswap(input_lo) + input_hi + detail::mul128_fold64(input_lo, input_hi);
+                return avalanche(acc);
+            }
+
+            if (len >= 4) {
+                const auto seed = Seed ^ (static_cast<std::uint64_t>(std::byteswap(static_cast<std::uint32_t>(Seed))) << 32U);
+                const auto input1 = detail::read_le<std::uint32_t>(value, 0);
+                const auto input2 = detail::read_le<std::uint32_t>(value, len - 4);
+                const auto bitflip = (secret64(8) ^ secret64(16)) - seed;
+                const auto input64 = input2 + (static_cast<std::uint64_t>(input1) << 32U);
+                return rrmxmx(input64 ^ bitflip, len);
+            }
+
+            if (len > 0) {
+                const auto c1 = detail::read_byte(value, 0);
+                const auto c2 = detail::read_byte(value, len >> 1U);
+                const auto c3 = detail::read_byte(value, len - 1);
+                const auto combined = (static_cast<std::uint32_t>(c1) << 16U) | (static_cast<std::uint32_t>(c2) << 24U) |
+                                      (static_cast<std::uint32_t>(c3) << 0U) | (static_cast<std::uint32_t>(len) << 8U);
+                const auto bitflip = static_cast<std::uint64_t>(secret32(0) ^ secret32(4)) + Seed;
+                return avalanche_xxh64(static_cast<std::uint64_t>(combined) ^ bitflip);
+            }
+
+            return avalanche_xxh64(Seed ^ (secret64(56) ^ secret64(64)));
+        }
+
+        template <detail::Hashable CharTy>
+        [[nodiscard]] static constexpr std::uint64_t hash_17to128(const std::span<CharTy>& value, const std::size_t len) noexcept {
+            std::uint64_t acc = len * Parameters::prime64_1;
+            for (std::size_t i = (len - 1) / 32 + 1; i-- > 0;) {
+                acc += mix16(value, 16 * i, 32 * i);
+                acc += mix16(value, len - 16 * (i + 1), 32 * i + 16);
+            }
+            return avalanche(acc);
+        }
+
+        template <detail::Hashable CharTy>
+        [[nodiscard]] static constexpr std::uint64_t hash_129to240(const std::span<CharTy>& value, const std::size_t len) noexcept {
+            std::uint64_t acc = len * Parameters::prime64_1;
+            for (std::size_t i = 0; i < 8; ++i) {
+                acc += mix16(value, 16 * i, 16 * i);
+            }
+            acc = avalanche(acc);
+
+            std::uint64_t acc_end = mix16(value, len - 16, Parameters::secret_size_min - Parameters::midsize_lastoffset);
+            for (std::size_t i = 8; i < len / 16; ++i) {
+                acc_end += mix16(value, 16 * i, 16 * (i - 8) + Parameters::midsize_startoffset);
+            }
+            return avalanche(acc + acc_end);
+        }
+
+        /// \brief Accumulate the stripes, then scramble the accumulators if scramble_offset is set
+        template <detail::Hashable CharTy>
+        static constexpr void accumulate(detail::Xxh3Accumulators& acc, const std::span<CharTy>& value, const std::size_t offset,
+                                         const std::size_t secret_offset, const std::size_t stripes,
+                                         const std::optional<std::size_t> scramble_offset = std::nullopt) noexcept {
+#if PLATFORM_IS_X86
+            if constexpr (sizeof(CharTy) == 1) {
+                if (!std::is_constant_evaluated()) {
+                    const auto* input = reinterpret_cast<const std::uint8_t*>(value.data()) + offset;
+                    const auto* scramble_secret = scramble_offset.has_value() ? kLongSecret.data() + *scramble_offset : nullptr;
+
+                    if (cpu::features().avx2) {
+                        detail::xxh3_accumulate_avx2(acc, input, kLongSecret.data() + secret_offset, stripes, scramble_secret);
+                        return;
+                    }
+                    if (cpu::features().sse2) {
+                        detail::xxh3_accumulate_sse2(acc, input, kLongSecret.data() + secret_offset, stripes, scramble_secret);
+                        return;
+                    }
+                }
+            }
+#endif
+
+            const auto long_secret = std::span<const std::uint8_t>(kLongSecret);
+            for (std::size_t n = 0; n < stripes; ++n) {
+                for (std::size_t lane = 0; lane < acc.size(); ++lane) {
+                    const auto data_val = detail::read_le<std::uint64_t>(value, offset + n * Parameters::stripe_len + lane * sizeof(std::uint64_t));
+                    const auto data_key = data_val ^ detail::read_le<std::uint64_t>(
+                                                         long_secret, secret_offset + n * Parameters::secret_consume_rate + lane * sizeof(std::uint64_t));
+                    acc.at(lane ^ 1U) += data_val;
+                    acc.at(lane) += (data_key & 0xFFFFFFFFULL) * (data_key >> 32U);
+                }
+            }
+
+            if (scramble_offset.has_value()) {
+                for (std::size_t lane = 0; lane < acc.size(); ++lane) {
+                    const auto key = detail::read_le<std::uint64_t>(long_secret, *scramble_offset + lane * sizeof(std::uint64_t));
+                    acc.at(lane) = (xorshift64(acc.at(lane), 47) ^ key) * Parameters::prime32_1;
+                }
+            }
+        }
+
+        template <detail::Hashable CharTy>
+        [[nodiscard]] static constexpr std::uint64_t hash_long(const std::span<CharTy>& value, const std::size_t len) noexcept {
+            constexpr std::size_t kStripesPerBlock = (kLongSecret.size() - Parameters::stripe_len) / Parameters::secret_consume_rate;
+            constexpr std::size_t kBlockLen = Parameters::stripe_len * kStripesPerBlock;
+            constexpr std::size_t kScrambleOffset = kLongSecret.size() - Parameters::stripe_len;
+
+            detail::Xxh3Accumulators acc = {
+                Parameters::prime32_3, Parameters::prime64_1, Parameters::prime64_2, Parameters::prime64_3,
+                Parameters::prime64_4, Parameters::prime32_2, Parameters::prime64_5, Parameters::prime32_1,
+            };
+
+            const std::size_t blocks = (len - 1) / kBlockLen;
+            for (std::size_t n = 0; n < blocks; ++n) {
+                accumulate(acc, value, n * kBlockLen, 0, kStripesPerBlock, kScrambleOffset);
+            }
+
+            // Last partial block, and the last stripe that overlaps it
+            const std::size_t stripes = ((len - 1) - (kBlockLen * blocks)) / Parameters::stripe_len;
+            accumulate(acc, value, blocks * kBlockLen, 0, stripes);
+            accumulate(acc, value, len - Parameters::stripe_len, kScrambleOffset - Parameters::secret_lastacc_start, 1);
+
+            // Merge the accumulators
+            std::uint64_t result = len * Parameters::prime64_1;
+            for (std::size_t i = 0; i < acc.size(); i += 2) {
+                const auto secret_offset = Parameters::secret_mergeaccs_start + i * sizeof(std::uint64_t);
+                const auto lo = acc.at(i) ^ detail::read_le<std::uint64_t>(std::span<const std::uint8_t>(kLongSecret), secret_offset);
+                const auto hi = acc.at(i + 1) ^ detail::read_le<std::uint64_t>(std::span<const std::uint8_t>(kLongSecret), secret_offset + sizeof(std::uint64_t));
+                result += detail::mul128_fold64(lo, hi);
+            }
+            return avalanche(result);
+        }
+
+    public:
+        template <detail::Hashable CharTy>
+        [[nodiscard]] static constexpr Ty hash_impl(const std::span<CharTy> value) noexcept {
+            // At runtime wide strings are hashed as their underlying bytes, so that they can use the fast paths as well
+            if constexpr (sizeof(CharTy) > 1 && std::endian::native == std::endian::little) {
+                if (!std::is_constant_evaluated()) {
+                    return hash_impl(std::span(reinterpret_cast<const std::uint8_t*>(value.data()), value.size_bytes()));
+                }
+            }
+
+            const std::size_t len = value.size_bytes();
+            if (len <= 16) {
+                return hash_0to16(value, len);
+            }
+            if (len <= 128) {
+                return hash_17to128(value, len);
+            }
+            if (len <= Parameters::midsize_max) {
+                return hash_129to240(value, len);
+            }
+            return hash_long(value, len);
+        }
+    };
+
+    using Xxh3_64 = Xxh3<std::uint64_t>;
+} // namespace hashes
+
+[[nodiscard]] consteval std::uint64_t operator""_xxh3_64(const char* value, std::size_t size) noexcept {
+    return hashes::Xxh3_64::hash(std::span(value, size));
+}
@@ -0,0 +1,244 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "es3n1n/common/base.hpp"
+#include "es3n1n/common/options.hpp"
+#include "reader.hpp"
+
+namespace memory {
+    /// \brief Read cache that fetches whole pages through the underlying read primitive
+    /// \note Pages are evicted in the least recently used order. Cached pages are never refreshed on their own,
+    ///     call `invalidate` whenever the underlying memory could have changed (e.g. once per frame)
+    /// \note Not thread-safe
+    class PageCache : public base::NonCopyable {
+    public:
+        static constexpr std::size_t kPageSize = COMMON_PAGE_SIZE;
+        static constexpr std::size_t kDefaultCapacity = 256;
+
+        /// \param capacity Maximum amount of cached pages
+        /// \throws std::invalid_argument if the capacity is zero
+        explicit PageCache(const ReadPrimitive read_func = default_read, const WritePrimitive write_func = default_write,
+                           const std::size_t capacity = kDefaultCapacity)
+            : read_primitive_(read_func), write_primitive_(write_func), capacity_(capacity) {
+            if (capacity == 0) {
+                throw std::invalid_argument("PageCache: invalid capacity");
+            }
+            index_.reserve(capacity);
+        }
+
+        /// \brief Read through the cache, pages that can't be fetched as a whole are read directly and aren't cached
+        std::expected<std::size_t, ErrorCode> read(void* buffer, const std::uintptr_t address, const std::size_t size) {
+            if (auto err = detail::sanitize_parameters(buffer, address, size); err.has_value()) {
+                return std::unexpected(err.value());
+            }
+
+            auto* output = static_cast<std::uint8_t*>(buffer);
+            for (std::size_t offset = 0; offset < size;) {
+                const auto current = address + offset;
+                const auto page_offset = current % kPageSize;
+                const auto chunk = std::min(size - offset, kPageSize - page_offset);
+
+                const auto* page = fetch(current - page_offset);
+                if (page == nullptr) {
+                    // Report the error of the remaining part, partial reads are reported as such
+                    const auto result = read_primitive_(output + offset, current, size - offset);
+                    if (!result.has_value()) {
+                        return std::unexpected(offset > 0 && result.error() == ErrorCode::INVALID_ADDRESS ? ErrorCode::NOT_ENOUGH_BYTES : result.error());
+                    }
+                    return size;
+                }
+
+                std::copy_n(page + page_offset, chunk, output + offset);
+                offset += chunk;
+            }
+            return size;
+        }
+
+        /// \brief Write through the underlying primitive, cached pages that overlap the written range are dropped
+        std::expected<std::size_t, ErrorCode> write(const std::uintptr_t address, const void* buffer, const std::size_t size) {
+            if (size != 0) {
+                for (auto page = address - address % kPageSize; page < address + size; page += kPageSize) {
+                    evict(page);
+                }
+            }
+            return write_primitive_(address, buffer, size);
+        }
+
+        /// \brief Invalidate all cached pages, they're refetched on the next read
+        void invalidate() noexcept {
+            ++generation_;
+        }
+
+        /// \brief Drop all cached pages and reset the counters
+        void clear() noexcept {
+            pages_.clear();
+            index_.clear();
+            hits_ = 0;
+            misses_ = 0;
+        }
+
+        void read_primitive(const ReadPrimitive read_func) {
+            read_primitive_ = read_func;
+            invalidate();
+        }
+
+        void write_primitive(const WritePrimitive write_func) {
+            write_primitive_ = write_func;
+        }
+
+        [[nodiscard]] std::uint64_t generation() const noexcept {
+            return generation_;
+        }
+
+        [[nodiscard]] std::size_t hits() const noexcept {
+            return hits_;
+        }
+
+        [[nodiscard]] std::size_t misses() const noexcept {
+            return misses_;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return pages_.size();
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept {
+            return capacity_;
+        }
+
+    private:
+        struct Page {
+            std::uintptr_t address = 0;
+            std::uint64_t generation = 0;
+            std::vector<std::uint8_t> data = {};
+        };
+
+        /// \brief Get the contents of the page, fetching it if it's not cached or outdated
+        /// \return nullptr if the page can't be read as a whole
+        [[nodiscard]] const std::uint8_t* fetch(const std::uintptr_t address) {
+            if (const auto it = index_.find(address); it != index_.end()) {
+                // Move to the front of the LRU list
+                pages_.splice(pages_.begin(), pages_, it->second);
+                auto& page = pages_.front();
+                if (page.generation == generation_) {
+                    ++hits_;
+                    return page.data.data();
+                }
+
+                ++misses_;
+                if (!read_primitive_(page.data.data(), address, kPageSize).has_value()) {
+                    evict(address);
+                    return nullptr;
+                }
+                page.generation = generation_;
+                return page.data.data();
+            }
+
+            ++misses_;
+            // Reuse the buffer of the least recently used page if the cache is full
+            if (pages_.size() >= capacity_) {
+                pages_.splice(pages_.begin(), pages_, std::prev(pages_.end()));
+                index_.erase(pages_.front().address);
+            } else {
+                pages_.emplace_front(Page{.data = std::vector<std::uint8_t>(kPageSize)});
+            }
+
+            auto& page = pages_.front();
+            if (!read_primitive_(page.data.data(), address, kPageSize).has_value()) {
+                pages_.pop_front();
+                return nullptr;
+            }
+
+            page.address = address;
+            page.generation = generation_;
+            index_.emplace(address, pages_.begin());
+            return page.data.data();
+        }
+
+        void evict(const std::uintptr_t address) {
+            if (const auto it = index_.find(address); it != index_.end()) {
+                pages_.erase(it->second);
+                index_.erase(it);
+            }
+        }
+
+        ReadPrimitive read_primitive_;
+        WritePrimitive write_primitive_;
+        std::size_t capacity_;
+
+        std::list<Page> pages_ = {};
+        std::unordered_map<std::uintptr_t, std::list<Page>::iterator> index_ = {};
+
+        std::uint64_t generation_ = 0;
+        std::size_t hits_ = 0;
+        std::size_t misses_ = 0;
+    };
+
+    namespace detail {
+        /// \brief Reader that currently reads through `page_cache()`
+        inline Reader* page_cache_reader = nullptr;
+        /// \brief Primitives of that reader before the cache was enabled, they're restored by `disable_page_cache`
+        inline ReadPrimitive page_cache_read = nullptr;
+        inline WritePrimitive page_cache_write = nullptr;
+        inline BatchReadPrimitive page_cache_read_batch = nullptr;
+    } // namespace detail
+
+    /// \brief The page cache used by `enable_page_cache`
+    [[nodiscard]] inline PageCache& page_cache() {
+        static PageCache instance;
+        return instance;
+    }
+
+    /// \brief Route the reads of the reader through `page_cache()`, the cache reads with the current primitives of the reader
+    /// \code
+    /// memory::process::attach(pid);
+    /// memory::enable_page_cache();
+    /// \endcode
+    /// \throws std::logic_error if the cache is already enabled, there's only one cache and it can't serve two targets
+    inline void enable_page_cache(Reader& reader = memory::reader) {
+        if (detail::page_cache_reader != nullptr) {
+            throw std::logic_error("enable_page_cache: the page cache is already enabled");
+        }
+
+        detail::page_cache_read = reader.read_primitive();
+        detail::page_cache_write = reader.write_primitive();
+        detail::page_cache_read_batch = reader.read_batch_primitive();
+
+        auto& cache = page_cache();
+        cache.read_primitive(detail::page_cache_read);
+        cache.write_primitive(detail::page_cache_write);
+
+        reader.read_primitive([](void* buffer, const std::uintptr_t address, const std::size_t size) -> std::expected<std::size_t, ErrorCode> {
+            return page_cache().read(buffer, address, size);
+        });
+        reader.write_primitive([](const std::uintptr_t address, const void* buffer, const std::size_t size) -> std::expected<std::size_t, ErrorCode> {
+            return page_cache().write(address, buffer, size);
+        });
+        // Batches are split into per-request reads, so that they go through the cache too
+        reader.read_batch_primitive(nullptr);
+        detail::page_cache_reader = &reader;
+    }
+
+    /// \brief Restore the primitives the reader had before `enable_page_cache`
+    /// \throws std::logic_error if the cache isn't enabled for this reader
+    inline void disable_page_cache(Reader& reader = memory::reader) {
+        if (detail::page_cache_reader != &reader) {
+            throw std::logic_error("disable_page_cache: the page cache isn't enabled for this reader");
+        }
+
+        reader.read_primitive(detail::page_cache_read);
+        reader.write_primitive(detail::page_cache_write);
+        reader.read_batch_primitive(detail::page_cache_read_batch);
+        page_cache().clear();
+
+        detail::page_cache_reader = nullptr;
+        detail::page_cache_read = nullptr;
+        detail::page_cache_write = nullptr;
+        detail::page_cache_read_batch = nullptr;
+    }
+} // namespace memory
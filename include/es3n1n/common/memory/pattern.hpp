@@ -0,0 +1,220 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "es3n1n/common/types.hpp"
+
+namespace memory {
+    namespace detail {
+        /// \brief Rough frequency of the byte in x86 code and data, used to pick the anchor bytes of a pattern
+        inline constexpr auto kByteFrequency = []() -> std::array<std::uint8_t, 0x100> {
+            std::array<std::uint8_t, 0x100> result = {};
+            result.fill(1);
+            // Padding, immediates and the most common opcodes, prefixes and ModRM bytes
+            for (const auto& [byte, frequency] : std::to_array<std::pair<std::uint8_t, std::uint8_t>>({
+                     {0x00, 255}, {0xFF, 200}, {0xCC, 160}, {0x48, 150}, {0x8B, 140}, {0x89, 120}, {0x24, 110}, {0x0F, 100},
+                     {0x4C, 90},  {0x8D, 90},  {0x44, 80},  {0xE8, 80},  {0x01, 70},  {0x83, 70},  {0x85, 60},  {0xC0, 60},
+                     {0x74, 50},  {0x75, 50},  {0x41, 50},  {0x49, 45},  {0x45, 45},  {0x90, 40},  {0xC3, 40},  {0x10, 40},
+                     {0x20, 40},  {0x08, 35},  {0x04, 35},  {0x02, 30},  {0x40, 30},  {0x28, 30},  {0x30, 30},  {0x50, 25},
+                     {0x33, 25},  {0xC7, 25},  {0x84, 25},  {0xE9, 25},  {0xEB, 25},  {0x18, 20},  {0x38, 20},  {0x03, 20},
+                 })) {
+                result[byte] = frequency;
+            }
+            return result;
+        }();
+
+        [[nodiscard]] constexpr std::optional<std::uint8_t> hex_digit(const char c) noexcept {
+            if (c >= '0' && c <= '9') {
+                return static_cast<std::uint8_t>(c - '0');
+            }
+            if (c >= 'a' && c <= 'f') {
+                return static_cast<std::uint8_t>(c - 'a' + 10);
+            }
+            if (c >= 'A' && c <= 'F') {
+                return static_cast<std::uint8_t>(c - 'A' + 10);
+            }
+            return std::nullopt;
+        }
+
+        /// \brief Parse an IDA-style pattern, e.g. "48 8B ?? ?? E8", invoking the callback with every byte and its mask
+        /// \return Amount of bytes in the pattern
+        /// \throws std::invalid_argument if the pattern is malformed, empty or consists of wildcards only
+        template <typename Fn>
+        constexpr std::size_t parse_pattern(const std::string_view pattern, Fn&& fn) {
+            std::size_t count = 0;
+            bool has_bytes = false;
+            for (std::size_t offset = 0; offset < pattern.size();) {
+                if (pattern[offset] == ' ') {
+                    ++offset;
+                    continue;
+                }
+
+                const auto end = std::min(pattern.find(' ', offset), pattern.size());
+                const auto token = pattern.substr(offset, end - offset);
+                offset = end;
+
+                if (token == "?" || token == "??") {
+                    fn(std::uint8_t{0}, std::uint8_t{0});
+                    ++count;
+                    continue;
+                }
+
+                const auto high = token.size() == 2 ? hex_digit(token[0]) : std::nullopt;
+                const auto low = token.size() == 2 ? hex_digit(token[1]) : std::nullopt;
+                if (!high.has_value() || !low.has_value()) {
+                    throw std::invalid_argument("Pattern: invalid byte");
+                }
+                fn(static_cast<std::uint8_t>((*high << 4U) | *low), std::uint8_t{0xFF});
+                has_bytes = true;
+                ++count;
+            }
+
+            if (!has_bytes) {
+                throw std::invalid_argument("Pattern: no bytes to match");
+            }
+            return count;
+        }
+
+        struct Anchors {
+            std::size_t first = 0;
+            std::size_t second = 0;
+        };
+
+        /// \brief Pick the two rarest non-wildcard bytes, candidates are the positions where both of them match
+        /// \note The anchors are the same if there's only one non-wildcard byte
+        [[nodiscard]] constexpr Anchors select_anchors(const std::span<const std::uint8_t> bytes, const std::span<const std::uint8_t> mask) noexcept {
+            constexpr std::size_t kNone = static_cast<std::size_t>(-1);
+            std::size_t first = kNone;
+            std::size_t second = kNone;
+            const auto rarer = [&](const std::size_t lhs, const std::size_t rhs) -> bool {
+                return rhs == kNone || kByteFrequency[bytes[lhs]] < kByteFrequency[bytes[rhs]];
+            };
+
+            for (std::size_t i = 0; i < bytes.size(); ++i) {
+                if (mask[i] == 0) {
+                    continue;
+                }
+                if (rarer(i, first)) {
+                    second = first;
+                    first = i;
+                } else if (rarer(i, second)) {
+                    second = i;
+                }
+            }
+            return {.first = first, .second = second == kNone ? first : second};
+        }
+    } // namespace detail
+
+    /// \brief Non-owning view of a byte pattern, bytes are matched as `(data[i] & mask[i]) == bytes[i]`
+    struct PatternView {
+        std::span<const std::uint8_t> bytes;
+        std::span<const std::uint8_t> mask;
+        detail::Anchors anchors;
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept {
+            return bytes.size();
+        }
+
+        [[nodiscard]] constexpr bool matches(const std::uint8_t* data) const noexcept {
+            for (std::size_t i = 0; i < bytes.size(); ++i) {
+                if ((data[i] & mask[i]) != bytes[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    /// \brief Byte pattern parsed at runtime from an IDA-style signature, e.g. "48 8B ?? ?? E8"
+    /// \note Wildcards are whole bytes, written as "?" or "??"
+    class Pattern {
+    public:
+        /// \throws std::invalid_argument if the pattern is malformed, empty or consists of wildcards only
+        explicit Pattern(const std::string_view pattern) {
+            detail::parse_pattern(pattern, [this](const std::uint8_t byte, const std::uint8_t mask) -> void {
+                bytes_.emplace_back(byte);
+                mask_.emplace_back(mask);
+            });
+            anchors_ = detail::select_anchors(bytes_, mask_);
+        }
+
+        [[nodiscard]] PatternView view() const noexcept {
+            return {.bytes = bytes_, .mask = mask_, .anchors = anchors_};
+        }
+
+        /* implicit */ operator PatternView() const noexcept { // NOLINT(google-explicit-constructor, hicpp-explicit-conversions)
+            return view();
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return bytes_.size();
+        }
+
+    private:
+        std::vector<std::uint8_t> bytes_ = {};
+        std::vector<std::uint8_t> mask_ = {};
+        detail::Anchors anchors_ = {};
+    };
+
+    /// \brief Byte pattern compiled from an IDA-style signature at compile time
+    /// \tparam Signature The signature, malformed signatures are compile-time errors
+    /// \note The bytes, the mask and the anchors are constants, nothing is parsed or allocated at runtime
+    /// \code
+    /// const auto match = memory::scan_first(module_range, "48 8B ?? ?? E8"_pattern);
+    /// \endcode
+    template <types::CtString Signature>
+    class CtPattern {
+        static constexpr std::string_view kSignature = {Signature.data.data(), Signature.size()};
+
+    public:
+        static constexpr std::size_t kSize = detail::parse_pattern(kSignature, [](std::uint8_t, std::uint8_t) -> void { });
+
+    private:
+        static constexpr auto kParsed = []() -> std::pair<std::array<std::uint8_t, kSize>, std::array<std::uint8_t, kSize>> {
+            std::pair<std::array<std::uint8_t, kSize>, std::array<std::uint8_t, kSize>> result = {};
+            std::size_t index = 0;
+            detail::parse_pattern(kSignature, [&result, &index](const std::uint8_t byte, const std::uint8_t mask) -> void {
+                result.first[index] = byte;
+                result.second[index] = mask;
+                ++index;
+            });
+            return result;
+        }();
+
+    public:
+        static constexpr std::array<std::uint8_t, kSize> kBytes = kParsed.first;
+        static constexpr std::array<std::uint8_t, kSize> kMask = kParsed.second;
+        static constexpr detail::Anchors kAnchors = detail::select_anchors(kBytes, kMask);
+
+        [[nodiscard]] static constexpr PatternView view() noexcept {
+            return {.bytes = kBytes, .mask = kMask, .anchors = kAnchors};
+        }
+
+        /* implicit */ constexpr operator PatternView() const noexcept { // NOLINT(google-explicit-constructor, hicpp-explicit-conversions)
+            return view();
+        }
+
+        [[nodiscard]] static constexpr std::size_t size() noexcept {
+            return kSize;
+        }
+
+        /// \brief Match the data against the pattern, only the non-wildcard bytes are compared
+        [[nodiscard]] static constexpr bool matches(const std::uint8_t* data) noexcept {
+            return [data]<std::size_t... Indices>(std::index_sequence<Indices...>) -> bool {
+                return ((kMask[Indices] == 0 || data[Indices] == kBytes[Indices]) && ...);
+            }(std::make_index_sequence<kSize>{});
+        }
+    };
+} // namespace memory
+
+template <types::CtString Signature>
+[[nodiscard]] consteval memory::CtPattern<Signature> operator""_pattern() noexcept {
+    return {};
+}
@@ -0,0 +1,152 @@
+#pragma once
+#include "es3n1n/common/platform.hpp"
+
+#if PLATFORM_IS_LINUX
+    #include <algorithm>
+    #include <atomic>
+    #include <cerrno>
+    #include <sys/types.h>
+    #include <sys/uio.h>
+    #include <vector>
+
+    #include "reader.hpp"
+
+namespace memory::process {
+    namespace detail {
+        inline std::atomic<pid_t> target_pid = 0;
+
+        /// \brief Maximum amount of iovecs per syscall, IOV_MAX on Linux
+        inline constexpr std::size_t kMaxIovecs = 1024;
+
+        [[nodiscard]] inline ErrorCode error_from_errno(const int error) noexcept {
+            switch (error) {
+            case EFAULT:
+                return ErrorCode::INVALID_ADDRESS;
+            case EINVAL:
+                return ErrorCode::INVALID_PARAMETERS;
+            default:
+                return ErrorCode::UNKNOWN_ERROR;
+            }
+        }
+
+        /// \brief Convert the syscall result, transfers that are shorter than requested are reported as NOT_ENOUGH_BYTES
+        [[nodiscard]] inline std::expected<std::size_t, ErrorCode> transfer_result(const ssize_t transferred, const std::size_t size) noexcept {
+            if (transferred < 0) {
+                return std::unexpected(error_from_errno(errno));
+            }
+            if (static_cast<std::size_t>(transferred) < size) {
+                return std::unexpected(ErrorCode::NOT_ENOUGH_BYTES);
+            }
+            return size;
+        }
+    } // namespace detail
+
+    /// \brief PID of the process that the primitives access
+    [[nodiscard]] inline pid_t target() noexcept {
+        return detail::target_pid.load(std::memory_order_relaxed);
+    }
+
+    /// \brief Read primitive for the target process, uses `process_vm_readv`
+    inline std::expected<std::size_t, ErrorCode> read(void* buffer, const std::uintptr_t address, const std::size_t size) {
+        if (auto err = memory::detail::sanitize_parameters(buffer, address, size); err.has_value()) {
+            return std::unexpected(err.value());
+        }
+
+        const iovec local = {.iov_base = buffer, .iov_len = size};
+        const iovec remote = {.iov_base = reinterpret_cast<void*>(address), .iov_len = size};
+        return detail::transfer_result(process_vm_readv(target(), &local, 1, &remote, 1, 0), size);
+    }
+
+    /// \brief Write primitive for the target process, uses `process_vm_writev`
+    inline std::expected<std::size_t, ErrorCode> write(const std::uintptr_t address, const void* buffer, const std::size_t size) {
+        if (auto err = memory::detail::sanitize_parameters(buffer, address, size); err.has_value()) {
+            return std::unexpected(err.value());
+        }
+
+        const iovec local = {.iov_base = const_cast<void*>(buffer), .iov_len = size};
+        const iovec remote = {.iov_base = reinterpret_cast<void*>(address), .iov_len = size};
+        return detail::transfer_result(process_vm_writev(target(), &local, 1, &remote, 1, 0), size);
+    }
+
+    /// \brief Batch read primitive for the target process, up to `IOV_MAX` requests are read with a single `process_vm_readv`
+    /// \note The syscall stops at the first request that can't be read, the requests after it are retried with another call
+    ///     if the request had a bad address. Any other error (e.g. the process is gone) is reported for all remaining requests
+    inline void read_batch(const std::span<ReadRequest> requests) {
+        const auto capacity = std::min(requests.size(), detail::kMaxIovecs);
+        std::vector<iovec> local(capacity);
+        std::vector<iovec> remote(capacity);
+        std::vector<std::size_t> indices(capacity);
+
+        for (std::size_t first = 0; first < requests.size();) {
+            std::size_t count = 0;
+            std::size_t next = first;
+            for (; next < requests.size() && count < capacity; ++next) {
+                auto& request = requests[next];
+                if (auto err = memory::detail::sanitize_parameters(request.buffer, request.address, request.size); err.has_value()) {
+                    request.result = std::unexpected(err.value());
+                    continue;
+                }
+
+                local[count] = {.iov_base = request.buffer, .iov_len = request.size};
+                remote[count] = {.iov_base = reinterpret_cast<void*>(request.address), .iov_len = request.size};
+                indices[count++] = next;
+            }
+            if (count == 0) {
+                first = next;
+                continue;
+            }
+
+            const auto transferred = process_vm_readv(target(), local.data(), count, remote.data(), count, 0);
+            if (transferred < 0) {
+                const auto error = errno;
+                // Nothing was read, so the very first request is the one that failed
+                if (error == EFAULT) {
+                    requests[indices[0]].result = std::unexpected(ErrorCode::INVALID_ADDRESS);
+                    first = indices[0] + 1;
+                    continue;
+                }
+
+                // The error isn't specific to the request, the remaining ones would fail the same way
+                for (std::size_t i = indices[0]; i < requests.size(); ++i) {
+                    auto& request = requests[i];
+                    const auto err = memory::detail::sanitize_parameters(request.buffer, request.address, request.size);
+                    request.result = std::unexpected(err.value_or(detail::error_from_errno(error)));
+                }
+                return;
+            }
+
+            auto remaining = static_cast<std::size_t>(transferred);
+            std::size_t done = 0;
+            for (; done < count && remaining >= local[done].iov_len; ++done) {
+                requests[indices[done]].result = local[done].iov_len;
+                remaining -= local[done].iov_len;
+            }
+            if (done == count) {
+                first = next;
+                continue;
+            }
+
+            requests[indices[done]].result = std::unexpected(remaining > 0 ? ErrorCode::NOT_ENOUGH_BYTES : ErrorCode::INVALID_ADDRESS);
+            first = indices[done] + 1;
+        }
+    }
+
+    /// \brief Make `memory::reader` access the memory of another process
+    /// \note Only one process can be attached at a time, the PID is shared by all users of these primitives
+    /// \note Requires the ptrace access to the process, e.g. being its parent or having CAP_SYS_PTRACE
+    inline void attach(const pid_t pid) {
+        detail::target_pid.store(pid, std::memory_order_relaxed);
+        memory::reader.read_primitive(read);
+        memory::reader.write_primitive(write);
+        memory::reader.read_batch_primitive(read_batch);
+    }
+
+    /// \brief Restore the primitives of the current process
+    inline void detach() {
+        memory::reader.read_primitive(default_read);
+        memory::reader.write_primitive(default_write);
+        memory::reader.read_batch_primitive(nullptr);
+        detail::target_pid.store(0, std::memory_order_relaxed);
+    }
+} // namespace memory::process
+#endif
@@ -4,6 +4,7 @@
 #include <expected>
 #include <functional>
 #include <optional>
+#include <span>
 #include <type_traits>
 
 #include "es3n1n/common/base.hpp"
@@ -21,6 +22,17 @@ namespace memory {
     using ReadPrimitive = std::expected<std::size_t, ErrorCode> (*)(void* buffer, std::uintptr_t address, std::size_t size);
     using WritePrimitive = std::expected<std::size_t, ErrorCode> (*)(std::uintptr_t address, const void* buffer, std::size_t size);
 
+    /// \brief A single entry of a vectored read, the result is filled in by the read
+    struct ReadRequest {
+        void* buffer = nullptr;
+        std::uintptr_t address = 0;
+        std::size_t size = 0;
+        std::expected<std::size_t, ErrorCode> result = std::unexpected(ErrorCode::UNKNOWN_ERROR);
+    };
+
+    /// \brief Read all requests at once and set the result of every one of them
+    using BatchReadPrimitive = void (*)(std::span<ReadRequest> requests);
+
     namespace detail {
         inline std::optional<ErrorCode> sanitize_parameters(const void* buffer, const std::uintptr_t address, const std::size_t size) {
             if (buffer == nullptr || address == 0U) {
@@ -42,6 +54,12 @@ namespace memory {
         return size;
     }
 
+    inline void default_read_batch(const std::span<ReadRequest> requests) {
+        for (auto& request : requests) {
+            request.result = default_read(request.buffer, request.address, request.size);
+        }
+    }
+
     inline std::expected<std::size_t, ErrorCode> default_write(const std::uintptr_t address, const void* buffer, const std::size_t size) {
         if (auto err = detail::sanitize_parameters(buffer, address, size); err.has_value()) {
             return std::unexpected(err.value());
@@ -60,10 +78,27 @@ namespace memory {
             read_primitive_ = read_func;
         }
 
+        [[nodiscard]] ReadPrimitive read_primitive() const noexcept {
+            return read_primitive_;
+        }
+
         void write_primitive(WritePrimitive write_func) {
             write_primitive_ = write_func;
         }
 
+        [[nodiscard]] WritePrimitive write_primitive() const noexcept {
+            return write_primitive_;
+        }
+
+        /// \brief Set the vectored read primitive, nullptr makes batches fall back to a read primitive call per request
+        void read_batch_primitive(BatchReadPrimitive read_batch_func) {
+            read_batch_primitive_ = read_batch_func;
+        }
+
+        [[nodiscard]] BatchReadPrimitive read_batch_primitive() const noexcept {
+            return read_batch_primitive_;
+        }
+
         std::expected<std::size_t, ErrorCode> read(void* buffer, const std::uintptr_t address, const std::size_t size) const {
             return read_primitive_(buffer, address, size);
         }
@@ -82,6 +117,24 @@ namespace memory {
             return obj;
         }
 
+        /// \brief Read multiple buffers at once, a backend can satisfy the whole batch with a single call (e.g. a single syscall)
+        /// \return Amount of successful requests, the result of every request is stored in it
+        std::size_t read_batch(const std::span<ReadRequest> requests) const {
+            if (read_batch_primitive_ != nullptr) {
+                read_batch_primitive_(requests);
+            } else {
+                for (auto& request : requests) {
+                    request.result = read_primitive_(request.buffer, request.address, request.size);
+                }
+            }
+
+            std::size_t result = 0;
+            for (const auto& request : requests) {
+                result += request.result.has_value() ? 1 : 0;
+            }
+            return result;
+        }
+
         std::expected<std::size_t, ErrorCode> write(const std::uintptr_t address, const void* buffer, const std::size_t size) const {
             return write_primitive_(address, buffer, size);
         }
@@ -94,6 +147,7 @@ namespace memory {
     private:
         ReadPrimitive read_primitive_;
         WritePrimitive write_primitive_;
+        BatchReadPrimitive read_batch_primitive_ = nullptr;
     };
 
     inline constinit auto reader = Reader();
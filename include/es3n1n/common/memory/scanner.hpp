@@ -0,0 +1,202 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <span>
+
+#include "es3n1n/common/cpu.hpp"
+#include "address.hpp"
+#include "pattern.hpp"
+#include "range.hpp"
+
+#if PLATFORM_IS_X86
+    #include <immintrin.h>
+#endif
+
+namespace memory {
+    namespace detail {
+        inline constexpr std::size_t kPatternNotFound = static_cast<std::size_t>(-1);
+
+        [[nodiscard]] inline bool matches_at(const std::uint8_t* data, const std::size_t offset, const PatternView& pattern) noexcept {
+            return data[offset + pattern.anchors.first] == pattern.bytes[pattern.anchors.first] &&
+                   data[offset + pattern.anchors.second] == pattern.bytes[pattern.anchors.second] && pattern.matches(data + offset);
+        }
+
+#if PLATFORM_IS_X86
+        /// \brief Find the pattern in whole 32-byte blocks of starting offsets, the offset is advanced past the scanned blocks
+        /// \note Both anchors are compared for 32 offsets at once, only the offsets where both of them match are verified
+        COMMON_TARGET("avx2")
+        inline std::size_t find_pattern_avx2(const std::uint8_t* data, const std::size_t end, std::size_t& offset, const PatternView& pattern) noexcept {
+            const auto first = _mm256_set1_epi8(static_cast<char>(pattern.bytes[pattern.anchors.first]));
+            const auto second = _mm256_set1_epi8(static_cast<char>(pattern.bytes[pattern.anchors.second]));
+
+            for (; offset + sizeof(__m256i) <= end; offset += sizeof(__m256i)) {
+                const auto first_data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + offset + pattern.anchors.first));
+                const auto second_data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + offset + pattern.anchors.second));
+                auto candidates = static_cast<std::uint32_t>(
+                    _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first_data, first), _mm256_cmpeq_epi8(second_data, second))));
+
+                for (; candidates != 0; candidates &= candidates - 1) {
+                    const auto candidate = offset + static_cast<std::size_t>(std::countr_zero(candidates));
+                    if (pattern.matches(data + candidate)) {
+                        return candidate;
+                    }
+                }
+            }
+            return kPatternNotFound;
+        }
+
+        /// \brief Find the pattern in whole 16-byte blocks of starting offsets, the offset is advanced past the scanned blocks
+        COMMON_TARGET("sse2")
+        inline std::size_t find_pattern_sse2(const std::uint8_t* data, const std::size_t end, std::size_t& offset, const PatternView& pattern) noexcept {
+            const auto first = _mm_set1_epi8(static_cast<char>(pattern.bytes[pattern.anchors.first]));
+            const auto second = _mm_set1_epi8(static_cast<char>(pattern.bytes[pattern.anchors.second]));
+
+            for (; offset + sizeof(__m128i) <= end; offset += sizeof(__m128i)) {
+                const auto first_data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset + pattern.anchors.first));
+                const auto second_data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset + pattern.anchors.second));
+                auto candidates =
+                    static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first_data, first), _mm_cmpeq_epi8(second_data, second))));
+
+                for (; candidates != 0; candidates &= candidates - 1) {
+                    const auto candidate = offset + static_cast<std::size_t>(std::countr_zero(candidates));
+                    if (pattern.matches(data + candidate)) {
+                        return candidate;
+                    }
+                }
+            }
+            return kPatternNotFound;
+        }
+#endif
+
+        /// \brief Find the first match of the pattern that starts at the offset or after it
+        /// \return Offset of the match, kPatternNotFound if there's none
+        [[nodiscard]] inline std::size_t find_pattern(const std::span<const std::uint8_t> data, std::size_t offset, const PatternView& pattern) noexcept {
+            if (pattern.size() == 0 || data.size() < pattern.size()) {
+                return kPatternNotFound;
+            }
+
+            // Exclusive end of the offsets where the whole pattern fits
+            const auto end = data.size() - pattern.size() + 1;
+#if PLATFORM_IS_X86
+            std::size_t result = kPatternNotFound;
+            if (cpu::features().avx2) {
+                result = find_pattern_avx2(data.data(), end, offset, pattern);
+            } else if (cpu::features().sse2) {
+                result = find_pattern_sse2(data.data(), end, offset, pattern);
+            }
+            if (result != kPatternNotFound) {
+                return result;
+            }
+#endif
+
+            for (; offset < end; ++offset) {
+                if (matches_at(data.data(), offset, pattern)) {
+                    return offset;
+                }
+            }
+            return kPatternNotFound;
+        }
+
+        [[nodiscard]] inline std::span<const std::uint8_t> range_bytes(const Range& range) noexcept {
+            return {range.start.as<const std::uint8_t*>(), range.size()};
+        }
+    } // namespace detail
+
+    /// \brief Lazy pattern scanner, matches are found one by one as they're requested
+    /// \note The pattern and the data are not copied, they should outlive the scanner. Ranges are read directly, so they
+    ///     should be readable memory of the current process
+    /// \code
+    /// const memory::Pattern pattern("48 8B ?? ?? E8");
+    /// for (const auto match : memory::Scanner(module_range, pattern)) { ... }
+    /// \endcode
+    class Scanner {
+    public:
+        class Iterator {
+        public:
+            using value_type = Address;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator() = default;
+            explicit Iterator(Scanner* scanner): scanner_(scanner), current_(scanner->next()) { }
+
+            [[nodiscard]] Address operator*() const noexcept {
+                return *current_;
+            }
+
+            Iterator& operator++() {
+                current_ = scanner_->next();
+                return *this;
+            }
+
+            void operator++(int) {
+                ++*this;
+            }
+
+            [[nodiscard]] bool operator==(std::default_sentinel_t) const noexcept {
+                return !current_.has_value();
+            }
+
+        private:
+            Scanner* scanner_ = nullptr;
+            std::optional<Address> current_ = std::nullopt;
+        };
+
+        Scanner(const std::span<const std::uint8_t> data, const PatternView& pattern) noexcept: data_(data), pattern_(pattern) { }
+        Scanner(const Range& range, const PatternView& pattern) noexcept: Scanner(detail::range_bytes(range), pattern) { }
+
+        /// \brief Find the next match, matches can overlap
+        [[nodiscard]] std::optional<Address> next() noexcept {
+            const auto offset = detail::find_pattern(data_, offset_, pattern_);
+            if (offset == detail::kPatternNotFound) {
+                offset_ = data_.size();
+                return std::nullopt;
+            }
+
+            offset_ = offset + 1;
+            return Address{data_.data() + offset};
+        }
+
+        /// \note The iteration continues from the current position of the scanner
+        [[nodiscard]] Iterator begin() {
+            return Iterator(this);
+        }
+
+        [[nodiscard]] static std::default_sentinel_t end() noexcept {
+            return std::default_sentinel;
+        }
+
+    private:
+        std::span<const std::uint8_t> data_;
+        PatternView pattern_;
+        std::size_t offset_ = 0;
+    };
+
+    /// \brief Find the matches of the pattern and store them into the buffer, the scan stops once the buffer is full
+    /// \return Amount of stored matches
+    inline std::size_t scan(const std::span<const std::uint8_t> data, const PatternView& pattern, const std::span<Address> out) noexcept {
+        Scanner scanner(data, pattern);
+        std::size_t count = 0;
+        for (; count < out.size(); ++count) {
+            const auto match = scanner.next();
+            if (!match.has_value()) {
+                break;
+            }
+            out[count] = *match;
+        }
+        return count;
+    }
+
+    inline std::size_t scan(const Range& range, const PatternView& pattern, const std::span<Address> out) noexcept {
+        return scan(detail::range_bytes(range), pattern, out);
+    }
+
+    [[nodiscard]] inline std::optional<Address> scan_first(const std::span<const std::uint8_t> data, const PatternView& pattern) noexcept {
+        return Scanner(data, pattern).next();
+    }
+
+    [[nodiscard]] inline std::optional<Address> scan_first(const Range& range, const PatternView& pattern) noexcept {
+        return scan_first(detail::range_bytes(range), pattern);
+    }
+} // namespace memory
@@ -57,6 +57,20 @@
 #endif
 /// \}
 
+/// \name Architecture Detection
+/// \{
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+    #define PLATFORM_IS_X86 true
+    #define PLATFORM_IS_ARM false
+#elif defined(_M_ARM64) || defined(__aarch64__) || defined(_M_ARM) || defined(__arm__)
+    #define PLATFORM_IS_X86 false
+    #define PLATFORM_IS_ARM true
+#else
+    #define PLATFORM_IS_X86 false
+    #define PLATFORM_IS_ARM false
+#endif
+/// \}
+
 /// \name Compiler Detection
 /// \{
 #if defined(__GNUC__)
@@ -90,6 +104,9 @@ namespace platform {
     [[maybe_unused]] constexpr bool is_unix = PLATFORM_IS_UNIX;
     [[maybe_unused]] constexpr bool is_posix = PLATFORM_IS_POSIX;
 
+    [[maybe_unused]] constexpr bool is_x86 = PLATFORM_IS_X86;
+    [[maybe_unused]] constexpr bool is_arm = PLATFORM_IS_ARM;
+
     [[maybe_unused]] constexpr bool is_gcc = PLATFORM_IS_GCC;
     [[maybe_unused]] constexpr bool is_clang = PLATFORM_IS_CLANG;
     [[maybe_unused]] constexpr bool is_msvc = PLATFORM_IS_MSVC;
@@ -106,3 +123,23 @@ namespace platform {
 #else
     #define COMMON_FORCE_INLINE inline __attribute__((always_inline))
 #endif
+
+/// \brief Compiles the function for the specified instruction set extensions, e.g. COMMON_TARGET("sse4.2")
+/// \note MSVC doesn't need this, intrinsics are always available there
+#if PLATFORM_IS_MSVC
+    #define COMMON_TARGET(x)
+#else
+    #define COMMON_TARGET(x) __attribute__((target(x)))
+#endif
+
+/// \brief Hints the CPU to fetch the cache line of the address, e.g. a few iterations before it's read
+#if PLATFORM_IS_MSVC
+    #if PLATFORM_IS_X86
+        #include <intrin.h>
+        #define COMMON_PREFETCH(x) _mm_prefetch(reinterpret_cast<const char*>(x), _MM_HINT_T0)
+    #else
+        #define COMMON_PREFETCH(x) static_cast<void>(x)
+    #endif
+#else
+    #define COMMON_PREFETCH(x) __builtin_prefetch(x)
+#endif
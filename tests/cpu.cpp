@@ -0,0 +1,22 @@
+#include <es3n1n/common/cpu.hpp>
+#include <gtest/gtest.h>
+
+TEST(cpu, features) {
+    const auto& features = cpu::features();
+    EXPECT_EQ(&features, &cpu::features());
+
+    // newer extensions imply the older ones
+    if (features.sse42) {
+        EXPECT_TRUE(features.sse41);
+    }
+    if (features.sse41) {
+        EXPECT_TRUE(features.ssse3);
+    }
+    if (features.ssse3) {
+        EXPECT_TRUE(features.sse2);
+    }
+
+    if constexpr (platform::is_x86 && platform::is_x64) {
+        EXPECT_TRUE(features.sse2);
+    }
+}
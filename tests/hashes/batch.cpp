@@ -0,0 +1,74 @@
+#include "es3n1n/common/hashes/crc.hpp"
+#include "es3n1n/common/hashes/fnv.hpp"
+#include "es3n1n/common/hashes/murmur.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr auto kHashManyFnv1a = []() -> std::array<std::uint32_t, 9> {
+        constexpr std::array<std::string_view, 9> kKeys = {"a", "bc", "def", "hello", "world", "ghijklmnop", "q", "rs", "tuv"};
+        std::array<std::uint32_t, 9> result = {};
+        hashes::Fnv1a_32::hash_many(kKeys, result);
+        return result;
+    }();
+
+    /// \brief Keys of mixed lengths, the count is not a multiple of the lane count so the scalar tail is used too
+    template <typename CharTy>
+    std::vector<std::basic_string<CharTy>> make_keys() {
+        std::vector<std::basic_string<CharTy>> result;
+        for (std::size_t i = 0; i < 77; ++i) {
+            std::basic_string<CharTy> key;
+            for (std::size_t j = 0; j < (i * 7) % 41; ++j) {
+                key.push_back(static_cast<CharTy>('0' + (i + j * 13) % 200));
+            }
+            result.emplace_back(std::move(key));
+        }
+        return result;
+    }
+
+    template <typename Hash, typename CharTy>
+    void test_hash_many() {
+        const auto keys = make_keys<CharTy>();
+        const std::vector<std::basic_string_view<CharTy>> views(keys.begin(), keys.end());
+
+        std::vector<decltype(Hash::hash(views.front()))> out(views.size());
+        Hash::hash_many(std::span<const std::basic_string_view<CharTy>>(views), std::span(out));
+        for (std::size_t i = 0; i < views.size(); ++i) {
+            EXPECT_EQ(out[i], Hash::hash(views[i])) << i;
+        }
+    }
+
+    template <typename Hash>
+    void test_hash_many() {
+        test_hash_many<Hash, char>();
+        test_hash_many<Hash, wchar_t>();
+
+        // same length keys never leave the lockstep loop
+        const std::vector<std::string_view> same_length = {"key0", "key1", "key2", "key3", "key4", "key5", "key6", "key7"};
+        std::vector<decltype(Hash::hash(same_length.front()))> out(same_length.size());
+        Hash::hash_many(same_length, out);
+        for (std::size_t i = 0; i < same_length.size(); ++i) {
+            EXPECT_EQ(out[i], Hash::hash(same_length[i])) << i;
+        }
+    }
+} // namespace
+
+/// Ensure compile-time batches work
+static_assert(kHashManyFnv1a[3] == "hello"_fnv1a_32);
+static_assert(kHashManyFnv1a[8] == "tuv"_fnv1a_32);
+
+TEST(batch, fnv1a) {
+    test_hash_many<hashes::Fnv1a_32>();
+    test_hash_many<hashes::Fnv1a_64>();
+}
+
+TEST(batch, murmur3) {
+    test_hash_many<hashes::Murmur3_32>();
+}
+
+TEST(batch, fallback) {
+    test_hash_many<hashes::Fnv1_32>();
+    test_hash_many<hashes::Crc32c>();
+    test_hash_many<hashes::Murmur3_128>();
+}
@@ -0,0 +1,123 @@
+#include "es3n1n/common/hashes/bloom_filter.hpp"
+#include "es3n1n/common/hashes/xxhash.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+    std::vector<std::string> make_keys(const std::string_view prefix, const std::size_t count) {
+        std::vector<std::string> result;
+        result.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            result.emplace_back(std::string(prefix) + std::to_string(i));
+        }
+        return result;
+    }
+} // namespace
+
+TEST(bloom_filter, membership) {
+    constexpr std::size_t kKeys = 10000;
+    auto filter = hashes::BloomFilter<>::with_capacity(kKeys, 0.01);
+    EXPECT_GT(filter.probes(), 1U);
+
+    const auto inserted = make_keys("inserted_", kKeys);
+    for (const auto& key : inserted) {
+        filter.insert(key);
+    }
+
+    // No false negatives
+    for (const auto& key : inserted) {
+        EXPECT_TRUE(filter.contains(key));
+    }
+
+    // False positives are close to the requested rate, blocking adds a bit on top of it
+    std::size_t false_positives = 0;
+    for (const auto& key : make_keys("missing_", kKeys)) {
+        false_positives += filter.contains(key) ? 1 : 0;
+    }
+    EXPECT_LT(false_positives, kKeys * 2 / 100);
+}
+
+TEST(bloom_filter, objects) {
+    hashes::BloomFilter<hashes::Xxh3_64> filter(64, 8);
+    for (std::uintptr_t address = 0x140000000; address < 0x140001000; address += 8) {
+        filter.insert_object(address);
+    }
+    EXPECT_TRUE(filter.contains_object(std::uintptr_t{0x140000008}));
+    EXPECT_TRUE(filter.contains_object(std::uintptr_t{0x140000ff8}));
+    EXPECT_EQ(filter.contains_object(std::uintptr_t{0x140000008}), filter.contains_hash(hashes::Xxh3_64::hash_object(std::uintptr_t{0x140000008})));
+}
+
+TEST(bloom_filter, batch) {
+    const auto keys = make_keys("key_", 1000);
+    const auto missing = make_keys("missing_", 1000);
+    std::vector<std::string_view> key_views(keys.begin(), keys.end());
+    key_views.insert(key_views.end(), missing.begin(), missing.end());
+
+    auto batched = hashes::BloomFilter<>::with_capacity(keys.size(), 0.01);
+    auto single = hashes::BloomFilter<>::with_capacity(keys.size(), 0.01);
+    batched.insert_many(std::span(key_views).first(keys.size()));
+    for (const auto& key : keys) {
+        single.insert(key);
+    }
+    EXPECT_EQ(batched.serialize(), single.serialize());
+
+    const auto found = std::make_unique<bool[]>(key_views.size());
+    batched.contains_many(key_views, std::span(found.get(), key_views.size()));
+    for (std::size_t i = 0; i < key_views.size(); ++i) {
+        EXPECT_EQ(found[i], single.contains(key_views[i])) << i;
+    }
+
+    std::vector<std::uint64_t> hashes(key_views.size());
+    hashes::Murmur3_64::hash_many(key_views, std::span(hashes));
+    const auto found_hashes = std::make_unique<bool[]>(hashes.size());
+    batched.contains_hashes(hashes, std::span(found_hashes.get(), hashes.size()));
+    EXPECT_TRUE(std::equal(found.get(), found.get() + key_views.size(), found_hashes.get()));
+}
+
+TEST(bloom_filter, merge) {
+    hashes::BloomFilter<> first(128, 7);
+    hashes::BloomFilter<> second(128, 7);
+    first.insert("foo");
+    second.insert("bar");
+
+    first.merge(second);
+    EXPECT_TRUE(first.contains("foo"));
+    EXPECT_TRUE(first.contains("bar"));
+    EXPECT_THROW(first.merge(hashes::BloomFilter<>(64, 7)), std::invalid_argument);
+
+    first.clear();
+    EXPECT_FALSE(first.contains("foo"));
+}
+
+TEST(bloom_filter, serialization) {
+    auto filter = hashes::BloomFilter<>::with_capacity(500, 0.001);
+    for (const auto& key : make_keys("key_", 500)) {
+        filter.insert(key);
+    }
+
+    const auto buffer = filter.serialize();
+    EXPECT_EQ(buffer.size(), 16 + filter.size_bytes());
+
+    const auto restored = hashes::BloomFilter<>::deserialize(buffer);
+    ASSERT_TRUE(restored.has_value());
+    EXPECT_EQ(restored->probes(), filter.probes());
+    EXPECT_EQ(restored->block_count(), filter.block_count());
+    EXPECT_EQ(restored->serialize(), buffer);
+    EXPECT_TRUE(restored->contains("key_42"));
+
+    // Malformed buffers
+    EXPECT_FALSE(hashes::BloomFilter<>::deserialize(std::span(buffer).first(10)).has_value());
+    EXPECT_FALSE(hashes::BloomFilter<>::deserialize(std::span(buffer).first(buffer.size() - 1)).has_value());
+    auto corrupted = buffer;
+    corrupted[0] ^= 0xFF;
+    EXPECT_FALSE(hashes::BloomFilter<>::deserialize(corrupted).has_value());
+}
+
+TEST(bloom_filter, invalid_arguments) {
+    EXPECT_THROW(hashes::BloomFilter<>(0, 4), std::invalid_argument);
+    EXPECT_THROW(hashes::BloomFilter<>(4, 0), std::invalid_argument);
+    EXPECT_THROW(hashes::BloomFilter<>(4, 17), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(hashes::BloomFilter<>::with_capacity(10, 1.0)), std::invalid_argument);
+}
@@ -0,0 +1,81 @@
+#include "es3n1n/common/hashes/case_insensitive.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+
+namespace {
+    template <typename Hash, typename BaseHash>
+    void test_folding() {
+        // every byte value, at every length around the vector widths
+        std::string mixed;
+        std::string lower;
+        for (std::size_t i = 0; i < 1000; ++i) {
+            const auto c = static_cast<char>(i * 7 + i / 256);
+            mixed.push_back(c);
+            lower.push_back(c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c);
+        }
+
+        for (std::size_t size = 0; size <= mixed.size(); size += size < 80 ? 1 : 37) {
+            EXPECT_EQ(Hash::hash(std::string_view(mixed).substr(0, size)), BaseHash::hash(std::string_view(lower).substr(0, size))) << size;
+        }
+    }
+} // namespace
+
+/// Ensure compile-time hashing works
+static_assert("Hello, World"_fnv1a_32_ci == "hello, world"_fnv1a_32);
+static_assert("HELLO"_fnv1a_64_ci == "hello"_fnv1a_64);
+static_assert("HeLLo"_murmur3_32_ci == "hello"_murmur3_32);
+static_assert("hElLo"_murmur3_64_ci == "hello"_murmur3_64);
+static_assert("[@Z`]"_fnv1a_32_ci == "[@z`]"_fnv1a_32);
+static_assert(hashes::Fnv1a_32_ci::Value{"GetProcAddress"} == "getprocaddress"_fnv1a_32_ci);
+
+TEST(case_insensitive, folding) {
+    test_folding<hashes::Fnv1a_32_ci, hashes::Fnv1a_32>();
+    test_folding<hashes::Fnv1a_64_ci, hashes::Fnv1a_64>();
+    test_folding<hashes::Murmur3_32_ci, hashes::Murmur3_32>();
+    test_folding<hashes::Murmur3_64_ci, hashes::Murmur3_64>();
+}
+
+TEST(case_insensitive, runtime_matches_literals) {
+    const std::string name = "KERNEL32.DLL";
+    EXPECT_EQ(hashes::Fnv1a_32_ci::hash(name), "kernel32.dll"_fnv1a_32_ci);
+    EXPECT_EQ(hashes::Fnv1a_32_ci::hash(name), "kernel32.dll"_fnv1a_32);
+    EXPECT_EQ(hashes::Murmur3_64_ci::hash(name), "kernel32.dll"_murmur3_64_ci);
+}
+
+TEST(case_insensitive, wide_chars) {
+    EXPECT_EQ(hashes::Fnv1a_32_ci::hash(L"KERNEL32.dll"), hashes::Fnv1a_32::hash(L"kernel32.dll"));
+    EXPECT_EQ(hashes::Murmur3_32_ci::hash(u"KERNEL32.dll"), hashes::Murmur3_32::hash(u"kernel32.dll"));
+
+    // Only ASCII letters are folded
+    EXPECT_NE(hashes::Fnv1a_32_ci::hash(L"Ā"), hashes::Fnv1a_32::hash(L"Ġ"));
+    EXPECT_EQ(hashes::Fnv1a_32_ci::hash(L"Ł"), hashes::Fnv1a_32::hash(L"Ł"));
+}
+
+#if PLATFORM_IS_X86
+TEST(case_insensitive, vector_paths) {
+    std::array<std::uint8_t, 256> input = {};
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        input.at(i) = static_cast<std::uint8_t>(i);
+    }
+
+    std::array<std::uint8_t, 256> expected = {};
+    std::ranges::transform(input, expected.begin(), [](const std::uint8_t c) { return hashes::detail::fold_ascii_case(c); });
+
+    std::array<std::uint8_t, 256> output = {};
+    EXPECT_EQ(hashes::detail::fold_ascii_case_sse2(input.data(), output.data(), input.size()), input.size());
+    EXPECT_EQ(output, expected);
+
+    if (cpu::features().avx2) {
+        output = {};
+        EXPECT_EQ(hashes::detail::fold_ascii_case_avx2(input.data(), output.data(), input.size() - 1), input.size() - sizeof(__m256i));
+        EXPECT_TRUE(std::equal(output.begin(), output.end() - sizeof(__m256i), expected.begin()));
+    }
+}
+#endif
+
+TEST(case_insensitive, streaming) {
+    hashes::Murmur3_32_ci::Hasher hasher;
+    hasher.update("HEL").update("lo, ").update(std::string(300, 'W'));
+    EXPECT_EQ(hasher.finalize(), hashes::Murmur3_32::hash("hello, " + std::string(300, 'w')));
+}
@@ -0,0 +1,111 @@
+#include "es3n1n/common/hashes/count_min.hpp"
+#include "es3n1n/common/hashes/xxhash.hpp"
+#include <gtest/gtest.h>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace {
+    std::vector<std::string> make_keys(const std::string_view prefix, const std::size_t count) {
+        std::vector<std::string> result;
+        result.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            result.emplace_back(std::string(prefix) + std::to_string(i));
+        }
+        return result;
+    }
+} // namespace
+
+TEST(count_min, estimate) {
+    auto sketch = hashes::CountMinSketch<>::with_error(0.001, 0.01);
+    EXPECT_EQ(sketch.width(), 4096U);
+    EXPECT_EQ(sketch.depth(), 5U);
+    EXPECT_EQ(sketch.size_bytes(), 4096U * 5U * sizeof(std::uint32_t));
+    EXPECT_EQ(sketch.estimate("foo"), 0U);
+
+    sketch.add("foo", 1000);
+    sketch.add("bar", 10);
+    sketch.add("bar");
+
+    const auto keys = make_keys("key_", 10000);
+    for (const auto& key : keys) {
+        sketch.add(key);
+    }
+
+    // Estimates never undercount, the overcount is bounded by epsilon * total
+    constexpr std::uint32_t kTotal = 1000 + 11 + 10000;
+    EXPECT_GE(sketch.estimate("foo"), 1000U);
+    EXPECT_LE(sketch.estimate("foo"), 1000U + kTotal / 1000);
+    EXPECT_GE(sketch.estimate("bar"), 11U);
+    EXPECT_LE(sketch.estimate("bar"), 11U + kTotal / 1000);
+    for (const auto& key : keys) {
+        EXPECT_GE(sketch.estimate(key), 1U);
+    }
+}
+
+TEST(count_min, objects) {
+    hashes::CountMinSketch<hashes::Xxh3_64> sketch(1024, 4);
+    for (std::uintptr_t address = 0x140000000; address < 0x140001000; address += 8) {
+        sketch.add_object(address, 3);
+    }
+    EXPECT_GE(sketch.estimate_object(std::uintptr_t{0x140000008}), 3U);
+    EXPECT_EQ(sketch.estimate_object(std::uintptr_t{0x140000008}), sketch.estimate_hash(hashes::Xxh3_64::hash_object(std::uintptr_t{0x140000008})));
+}
+
+TEST(count_min, batch) {
+    const auto keys = make_keys("key_", 1000);
+    const std::vector<std::string_view> key_views(keys.begin(), keys.end());
+
+    hashes::CountMinSketch<> batched(256, 4);
+    hashes::CountMinSketch<> single(256, 4);
+    batched.add_many(key_views, 2);
+    for (const auto& key : keys) {
+        single.add(key, 2);
+    }
+
+    std::vector<std::uint32_t> counts(key_views.size());
+    batched.estimate_many(key_views, std::span(counts));
+    for (std::size_t i = 0; i < key_views.size(); ++i) {
+        EXPECT_EQ(counts[i], single.estimate(key_views[i])) << i;
+    }
+
+    std::vector<std::uint64_t> hashes(key_views.size());
+    hashes::Murmur3_64::hash_many(key_views, std::span(hashes));
+    std::vector<std::uint32_t> hash_counts(hashes.size());
+    batched.estimate_hashes(hashes, std::span(hash_counts));
+    EXPECT_EQ(hash_counts, counts);
+}
+
+TEST(count_min, merge) {
+    hashes::CountMinSketch<> first(128, 4);
+    hashes::CountMinSketch<> second(128, 4);
+    first.add("foo", 5);
+    second.add("foo", 7);
+    second.add("bar");
+
+    first.merge(second);
+    EXPECT_GE(first.estimate("foo"), 12U);
+    EXPECT_GE(first.estimate("bar"), 1U);
+    EXPECT_THROW(first.merge(hashes::CountMinSketch<>(64, 4)), std::invalid_argument);
+    EXPECT_THROW(first.merge(hashes::CountMinSketch<>(128, 3)), std::invalid_argument);
+
+    first.clear();
+    EXPECT_EQ(first.estimate("foo"), 0U);
+}
+
+TEST(count_min, saturation) {
+    hashes::CountMinSketch<hashes::Murmur3_64, std::uint8_t> sketch(16, 2);
+    sketch.add("foo", 200);
+    sketch.add("foo", 100);
+    EXPECT_EQ(sketch.estimate("foo"), 0xFFU);
+}
+
+TEST(count_min, invalid_arguments) {
+    EXPECT_THROW(hashes::CountMinSketch<>(0, 4), std::invalid_argument);
+    EXPECT_THROW(hashes::CountMinSketch<>(100, 4), std::invalid_argument);
+    EXPECT_THROW(hashes::CountMinSketch<>(128, 0), std::invalid_argument);
+    EXPECT_THROW(hashes::CountMinSketch<>(std::size_t{1} << 31U, std::numeric_limits<std::size_t>::max() / 2), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(hashes::CountMinSketch<>::with_error(0.0, 0.01)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(hashes::CountMinSketch<>::with_error(0.01, 1.0)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(hashes::CountMinSketch<>::with_error(1e-20, 0.01)), std::invalid_argument);
+}
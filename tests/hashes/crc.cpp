@@ -1,11 +1,197 @@
 #include "es3n1n/common/hashes/crc.hpp"
 #include <gtest/gtest.h>
+#include <numeric>
+#include <vector>
 
 /// Ensure compile-time hashing works
 static_assert("hello"_crcb_32 == 0x3610a686);
+static_assert("123456789"_crcb_32 == 0xcbf43926);
+
+static_assert("hello"_crc32c == 0x9a71bb4c);
+static_assert("123456789"_crc32c == 0xe3069283);
+
+/// Ensure compile-time combining works
+static_assert(hashes::crc32_combine("hello, "_crcb_32, "world"_crcb_32, 5) == "hello, world"_crcb_32);
+static_assert(hashes::crc32_combine("hello"_crcb_32, ""_crcb_32, 0) == "hello"_crcb_32);
+static_assert(hashes::Crc32c::combine("hello, "_crc32c, "world"_crc32c, 5) == "hello, world"_crc32c);
+
+/// Check values of the CRC catalogue
+static_assert("123456789"_crc16_ccitt == 0x29B1);
+static_assert(hashes::Crc16_kermit::hash("123456789") == 0x2189);
+static_assert("123456789"_crc64_ecma == 0x6C40DF5F0B497347);
+static_assert("123456789"_crc64_xz == 0x995DC9BBDF1939FA);
+static_assert(hashes::Crc64_xz::combine("hello, "_crc64_xz, "world"_crc64_xz, 5) == "hello, world"_crc64_xz);
+
+namespace {
+    /// Textbook bitwise implementation
+    std::uint32_t reference_crc32(const std::uint32_t polynomial, const std::uint8_t* data, const std::size_t size) {
+        std::uint32_t result = ~0U;
+        for (std::size_t i = 0; i < size; ++i) {
+            result ^= data[i];
+            for (int bit = 0; bit < 8; ++bit) {
+                result = (result >> 1) ^ ((result & 1) * polynomial);
+            }
+        }
+        return ~result;
+    }
+
+    /// Textbook bitwise implementation of the generic model, with the register always kept in the normal representation
+    template <typename Parameters>
+    typename Parameters::ValueTy reference_crc(const std::uint8_t* data, const std::size_t size) {
+        using Ty = typename Parameters::ValueTy;
+        const auto reflect = [](std::uint64_t value, const std::size_t width) {
+            std::uint64_t result = 0;
+            for (std::size_t i = 0; i < width; ++i, value >>= 1) {
+                result = (result << 1) | (value & 1);
+            }
+            return result;
+        };
+
+        const auto top_bit = std::uint64_t{1} << (Parameters::width - 1);
+        const auto mask = (top_bit << 1) - 1;
+        std::uint64_t result = Parameters::init;
+        for (std::size_t i = 0; i < size; ++i) {
+            const auto byte = Parameters::reflect ? reflect(data[i], 8) : data[i];
+            for (std::size_t bit = 0; bit < 8; ++bit) {
+                const bool feedback = ((result & top_bit) != 0) != ((byte >> (7 - bit)) & 1);
+                result = ((result << 1) & mask) ^ (feedback ? static_cast<std::uint64_t>(Parameters::polynomial) : 0);
+            }
+        }
+        if (Parameters::reflect) {
+            result = reflect(result, Parameters::width);
+        }
+        return static_cast<Ty>(result ^ Parameters::xor_out);
+    }
+
+    template <typename Parameters>
+    void test_generic_against_reference() {
+        using Hash = hashes::Crc<Parameters>;
+
+        std::vector<std::uint8_t> buffer(100);
+        std::iota(buffer.begin(), buffer.end(), 0x55);
+        for (std::size_t offset = 0; offset < 3; ++offset) {
+            for (std::size_t size = 0; size + offset <= buffer.size(); ++size) {
+                const auto expected = reference_crc<Parameters>(buffer.data() + offset, size);
+                EXPECT_EQ(Hash::hash(std::span(buffer.data() + offset, size)), expected) << size;
+
+                typename Hash::Hasher hasher;
+                hasher.update(std::span(buffer.data() + offset, size / 2)).update(std::span(buffer.data() + offset + size / 2, size - size / 2));
+                EXPECT_EQ(hasher.finalize(), expected) << size;
+            }
+        }
+    }
+
+    template <typename Hash>
+    void test_against_reference(const std::uint32_t polynomial) {
+        std::vector<std::uint8_t> buffer(300);
+        std::iota(buffer.begin(), buffer.end(), 0);
+
+        // every length around the slice/fold boundaries, with unaligned starts as well
+        for (std::size_t offset = 0; offset < 4; ++offset) {
+            for (std::size_t size = 0; size + offset <= buffer.size(); ++size) {
+                EXPECT_EQ(Hash::hash(std::span(buffer.data() + offset, size)), reference_crc32(polynomial, buffer.data() + offset, size));
+            }
+        }
+    }
+} // namespace
 
 TEST(crc, crc32b) {
     EXPECT_EQ("hello"_crcb_32, 0x3610a686);
     EXPECT_EQ(hashes::Crcb_32::hash("hello"), 0x3610a686);
     EXPECT_EQ(hashes::Crcb_32::hash(L"hello"), 0x3610a686);
 }
+
+TEST(crc, crc32b_runtime) {
+    constexpr auto kLong = "This is a long string to test the sliced CRC32 implementation against the bytewise one."_crcb_32;
+    EXPECT_EQ(hashes::Crcb_32::hash("This is a long string to test the sliced CRC32 implementation against the bytewise one."), kLong);
+    EXPECT_EQ(hashes::Crcb_32::hash(L"This is a long string to test the sliced CRC32 implementation against the bytewise one."), kLong);
+    EXPECT_EQ(hashes::Crcb_32::hash("123456789"), 0xcbf43926);
+
+    test_against_reference<hashes::Crcb_32>(0xEDB88320);
+}
+
+TEST(crc, crc32c) {
+    EXPECT_EQ("hello"_crc32c, 0x9a71bb4c);
+    EXPECT_EQ(hashes::Crc32c::hash("hello"), 0x9a71bb4c);
+    EXPECT_EQ(hashes::Crc32c::hash(L"hello"), 0x9a71bb4c);
+    EXPECT_EQ(hashes::Crc32c::hash("123456789"), 0xe3069283);
+
+    test_against_reference<hashes::Crc32c>(0x82F63B78);
+}
+
+TEST(crc, combine) {
+    std::vector<std::uint8_t> buffer(1000);
+    std::iota(buffer.begin(), buffer.end(), 0);
+    const auto data = std::span(buffer);
+
+    for (std::size_t split = 0; split <= data.size(); split += 37) {
+        const auto a = data.first(split);
+        const auto b = data.subspan(split);
+        EXPECT_EQ(hashes::crc32_combine(hashes::Crcb_32::hash(a), hashes::Crcb_32::hash(b), b.size()), hashes::Crcb_32::hash(data));
+        EXPECT_EQ(hashes::Crc32c::combine(hashes::Crc32c::hash(a), hashes::Crc32c::hash(b), b.size()), hashes::Crc32c::hash(data));
+    }
+}
+
+TEST(crc, hash_parallel) {
+    std::vector<std::uint8_t> buffer(4 * 1024 * 1024 + 123);
+    std::iota(buffer.begin(), buffer.end(), 0);
+    const auto data = std::span(buffer);
+
+    const auto expected = hashes::Crcb_32::hash(data);
+    EXPECT_EQ(hashes::Crcb_32::hash_parallel(data), expected);
+    EXPECT_EQ(hashes::Crcb_32::hash_parallel(data, 1), expected);
+    EXPECT_EQ(hashes::Crcb_32::hash_parallel(data, 3), expected);
+    EXPECT_EQ(hashes::Crcb_32::hash_parallel(data, 64), expected);
+
+    EXPECT_EQ(hashes::Crc32c::hash_parallel(data, 4), hashes::Crc32c::hash(data));
+
+    // too small to be split
+    EXPECT_EQ(hashes::Crcb_32::hash_parallel(data.first(100), 4), hashes::Crcb_32::hash(data.first(100)));
+    EXPECT_EQ(hashes::Crcb_32::hash_parallel(std::span<const char>{}), 0U);
+}
+
+TEST(crc, generic) {
+    EXPECT_EQ(hashes::Crc16_ccitt::hash("123456789"), 0x29B1);
+    EXPECT_EQ(hashes::Crc16_kermit::hash("123456789"), 0x2189);
+    EXPECT_EQ(hashes::Crc64_ecma::hash("123456789"), 0x6C40DF5F0B497347);
+    EXPECT_EQ(hashes::Crc64_xz::hash("123456789"), 0x995DC9BBDF1939FA);
+
+    // CRC-8/SMBUS and CRC-16/RIELLO, a narrow crc and a reflected one with an asymmetric init
+    using Crc8Smbus = hashes::CrcParameters<std::uint16_t, 8, 0x07, 0, false, 0>;
+    using Crc16Riello = hashes::CrcParameters<std::uint16_t, 16, 0x1021, 0xB2AA, true, 0>;
+    EXPECT_EQ(hashes::Crc<Crc8Smbus>::hash("123456789"), 0xF4);
+    EXPECT_EQ(hashes::Crc<Crc16Riello>::hash("123456789"), 0x63D0);
+
+    test_generic_against_reference<Crc8Smbus>();
+    test_generic_against_reference<Crc16Riello>();
+    test_generic_against_reference<hashes::CrcParameters<std::uint32_t, 24, 0x864CFB, 0xB704CE, false, 0>>(); // CRC-24/OPENPGP
+    test_generic_against_reference<hashes::CrcParameters<std::uint64_t, 40, 0x0004820009, 0, false, 0xFFFFFFFFFF>>(); // CRC-40/GSM
+    test_generic_against_reference<hashes::CrcParameters<std::uint32_t, 32, 0x04C11DB7, 0xFFFFFFFF, false, 0xFFFFFFFF>>(); // CRC-32/BZIP2
+}
+
+TEST(crc, generic_presets) {
+    test_generic_against_reference<hashes::CrcParameters<std::uint16_t, 16, 0x1021, 0xFFFF, false, 0>>();
+    test_generic_against_reference<hashes::CrcParameters<std::uint16_t, 16, 0x1021, 0, true, 0>>();
+    test_generic_against_reference<hashes::CrcParameters<std::uint64_t, 64, 0x42F0E1EBA9EA3693, 0, false, 0>>();
+    test_generic_against_reference<hashes::CrcParameters<std::uint64_t, 64, 0x42F0E1EBA9EA3693, ~0ULL, true, ~0ULL>>();
+    test_generic_against_reference<hashes::CrcParameters<std::uint32_t, 32, 0x1EDC6F41, 0xFFFFFFFF, true, 0xFFFFFFFF>>();
+}
+
+TEST(crc, generic_combine) {
+    std::vector<std::uint8_t> buffer(1000);
+    std::iota(buffer.begin(), buffer.end(), 0);
+    const auto data = std::span(buffer);
+
+    using Crc16Riello = hashes::Crc<hashes::CrcParameters<std::uint16_t, 16, 0x1021, 0xB2AA, true, 0>>;
+    for (std::size_t split = 0; split <= data.size(); split += 37) {
+        const auto a = data.first(split);
+        const auto b = data.subspan(split);
+        EXPECT_EQ(hashes::Crc64_xz::combine(hashes::Crc64_xz::hash(a), hashes::Crc64_xz::hash(b), b.size()), hashes::Crc64_xz::hash(data));
+        EXPECT_EQ(hashes::Crc16_kermit::combine(hashes::Crc16_kermit::hash(a), hashes::Crc16_kermit::hash(b), b.size()), hashes::Crc16_kermit::hash(data));
+        EXPECT_EQ(Crc16Riello::combine(Crc16Riello::hash(a), Crc16Riello::hash(b), b.size()), Crc16Riello::hash(data));
+    }
+
+    std::vector<std::uint8_t> large(1024 * 1024 + 7);
+    std::iota(large.begin(), large.end(), 0);
+    EXPECT_EQ(hashes::Crc64_xz::hash_parallel(std::span(large), 3), hashes::Crc64_xz::hash(std::span(large)));
+}
@@ -0,0 +1,94 @@
+#include "es3n1n/common/hashes/crc.hpp"
+#include "es3n1n/common/hashes/fnv.hpp"
+#include "es3n1n/common/hashes/murmur.hpp"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+/// Ensure compile-time streaming works
+static_assert(hashes::Fnv1a_32::Hasher().update("he").update("llo").finalize() == "hello"_fnv1a_32);
+static_assert(hashes::Crcb_32::Hasher().update("h").update("ello").finalize() == "hello"_crcb_32);
+static_assert(hashes::Murmur3_32::Hasher().update("hel").update("lo").finalize() == "hello"_murmur3_32);
+
+static_assert(std::is_trivially_copyable_v<hashes::Fnv1_64::Hasher>);
+static_assert(std::is_trivially_copyable_v<hashes::Crc32c::Hasher>);
+static_assert(std::is_trivially_copyable_v<hashes::Murmur3_32::Hasher>);
+static_assert(std::is_trivially_copyable_v<hashes::Murmur3_128::Hasher>);
+
+namespace {
+    template <typename Hash>
+    void test_chunked() {
+        std::vector<std::uint8_t> buffer(67);
+        std::iota(buffer.begin(), buffer.end(), 0x70);
+        const auto data = std::span(buffer);
+
+        // every split point, hashed as three chunks
+        for (std::size_t first = 0; first <= data.size(); ++first) {
+            for (std::size_t second = first; second <= data.size(); second += 3) {
+                typename Hash::Hasher hasher;
+                hasher.update(data.subspan(0, first));
+                hasher.update(data.subspan(first, second - first));
+                hasher.update(data.subspan(second));
+                EXPECT_EQ(hasher.finalize(), Hash::hash(data));
+            }
+        }
+    }
+
+    template <typename Hash>
+    void test_fork() {
+        typename Hash::Hasher prefix;
+        prefix.update("common prefix/");
+
+        auto fork = prefix;
+        EXPECT_EQ(prefix.update("a").finalize(), Hash::hash("common prefix/a"));
+        EXPECT_EQ(fork.update(std::string_view("bcd")).finalize(), Hash::hash("common prefix/bcd"));
+
+        EXPECT_EQ(fork.init().update(std::string("hello")).finalize(), Hash::hash("hello"));
+    }
+} // namespace
+
+TEST(hasher, fnv) {
+    test_chunked<hashes::Fnv1_32>();
+    test_chunked<hashes::Fnv1a_64>();
+    test_fork<hashes::Fnv1_64>();
+    test_fork<hashes::Fnv1a_32>();
+}
+
+TEST(hasher, crc) {
+    test_chunked<hashes::Crcb_32>();
+    test_chunked<hashes::Crc32c>();
+    test_fork<hashes::Crcb_32>();
+    test_fork<hashes::Crc32c>();
+}
+
+TEST(hasher, murmur) {
+    test_chunked<hashes::Murmur3_32>();
+    test_fork<hashes::Murmur3_32>();
+
+    // block boundaries with wide characters
+    hashes::Murmur3_32::Hasher hasher;
+    hasher.update(L"abcd").update(L"efg");
+    EXPECT_EQ(hasher.finalize(), hashes::Murmur3_32::hash(L"abcdefg"));
+
+    // bytes of wide characters split across blocks
+    const std::wstring_view wide = L"bcdefg";
+    std::vector<std::uint8_t> bytes = {'a'};
+    bytes.resize(1 + wide.size() * sizeof(wchar_t));
+    std::memcpy(bytes.data() + 1, wide.data(), wide.size() * sizeof(wchar_t));
+
+    hasher.init().update("a").update(wide);
+    EXPECT_EQ(hasher.finalize(), hashes::Murmur3_32::hash(std::span(bytes)));
+}
+
+TEST(hasher, murmur_seeded) {
+    using Seeded = hashes::Murmur3<std::uint32_t, 0x1234>;
+    EXPECT_NE(Seeded::hash("hello"), hashes::Murmur3_32::hash("hello"));
+    EXPECT_EQ(Seeded::Hasher().update("he").update("llo").finalize(), Seeded::hash("hello"));
+}
+
+TEST(hasher, murmur_128) {
+    test_chunked<hashes::Murmur3_128>();
+    test_chunked<hashes::Murmur3_64>();
+    test_fork<hashes::Murmur3_128>();
+}
@@ -0,0 +1,94 @@
+#include "es3n1n/common/hashes/hyperloglog.hpp"
+#include "es3n1n/common/hashes/xxhash.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace {
+    std::vector<std::string> make_keys(const std::string_view prefix, const std::size_t count) {
+        std::vector<std::string> result;
+        result.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            result.emplace_back(std::string(prefix) + std::to_string(i));
+        }
+        return result;
+    }
+
+    void expect_close(const double estimate, const double expected, const double tolerance) {
+        EXPECT_NEAR(estimate, expected, expected * tolerance) << estimate;
+    }
+} // namespace
+
+static_assert(hashes::HyperLogLog<>::size_bytes() == 16384);
+static_assert(hashes::HyperLogLog<10>::size_bytes() == 1024);
+
+TEST(hyperloglog, estimate) {
+    hashes::HyperLogLog<> sketch;
+    EXPECT_EQ(sketch.estimate(), 0.0);
+
+    // Small cardinalities are handled by linear counting and are nearly exact
+    for (const auto& key : make_keys("key_", 100)) {
+        sketch.add(key);
+    }
+    expect_close(sketch.estimate(), 100.0, 0.02);
+
+    // Duplicates don't affect the estimate
+    for (const auto& key : make_keys("key_", 100)) {
+        sketch.add(key);
+    }
+    expect_close(sketch.estimate(), 100.0, 0.02);
+
+    for (const auto& key : make_keys("key_", 200000)) {
+        sketch.add(key);
+    }
+    expect_close(sketch.estimate(), 200000.0, 0.03);
+}
+
+TEST(hyperloglog, objects) {
+    hashes::HyperLogLog<12, hashes::Xxh3_64> sketch;
+    for (std::uintptr_t address = 0x140000000; address < 0x140000000 + 50000 * 8; address += 8) {
+        sketch.add_object(address);
+    }
+    expect_close(sketch.estimate(), 50000.0, 0.05);
+}
+
+TEST(hyperloglog, batch) {
+    const auto keys = make_keys("key_", 10000);
+    const std::vector<std::string_view> key_views(keys.begin(), keys.end());
+
+    hashes::HyperLogLog<> batched;
+    hashes::HyperLogLog<> single;
+    batched.add_many(key_views);
+    for (const auto& key : keys) {
+        single.add(key);
+    }
+    EXPECT_EQ(batched.estimate(), single.estimate());
+
+    std::vector<std::uint64_t> hashes(key_views.size());
+    hashes::Murmur3_64::hash_many(key_views, std::span(hashes));
+    hashes::HyperLogLog<> from_hashes;
+    from_hashes.add_hashes(hashes);
+    EXPECT_EQ(from_hashes.estimate(), single.estimate());
+}
+
+TEST(hyperloglog, merge) {
+    hashes::HyperLogLog<> first;
+    hashes::HyperLogLog<> second;
+    hashes::HyperLogLog<> both;
+    for (const auto& key : make_keys("first_", 30000)) {
+        first.add(key);
+        both.add(key);
+    }
+    for (const auto& key : make_keys("second_", 30000)) {
+        second.add(key);
+        both.add(key);
+    }
+
+    // Merging is lossless, the result is the same as adding all keys to a single sketch
+    first.merge(second);
+    EXPECT_EQ(first.estimate(), both.estimate());
+    expect_close(first.estimate(), 60000.0, 0.03);
+
+    first.clear();
+    EXPECT_EQ(first.estimate(), 0.0);
+}
@@ -0,0 +1,98 @@
+#include "es3n1n/common/hashes/crc.hpp"
+#include "es3n1n/common/hashes/fnv.hpp"
+#include "es3n1n/common/hashes/murmur.hpp"
+#include "es3n1n/common/hashes/xxhash.hpp"
+#include <gtest/gtest.h>
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Record {
+        std::uint32_t id;
+        std::uint16_t flags;
+        std::uint16_t kind;
+    };
+
+    constexpr Record kRecord = {.id = 0x11223344, .flags = 0x5566, .kind = 0x7788};
+    constexpr std::array<std::uint8_t, sizeof(Record)> kRecordBytes = {0x44, 0x33, 0x22, 0x11, 0x66, 0x55, 0x88, 0x77};
+
+    constexpr std::array<std::byte, 5> kHelloBytes = {std::byte{'h'}, std::byte{'e'}, std::byte{'l'}, std::byte{'l'}, std::byte{'o'}};
+
+    template <typename Hash>
+    void test_inputs() {
+        const auto expected = Hash::hash("hello");
+
+        // every single byte character type is hashed the same way
+        EXPECT_EQ(Hash::hash(u8"hello"), expected);
+        EXPECT_EQ(Hash::hash(std::u8string(u8"hello")), expected);
+        EXPECT_EQ(Hash::hash(std::u8string_view(u8"hello")), expected);
+        EXPECT_EQ(Hash::hash(std::span(kHelloBytes)), expected);
+        EXPECT_EQ(Hash::hash(kHelloBytes.data(), kHelloBytes.size()), expected);
+
+        // contiguous ranges
+        EXPECT_EQ(Hash::hash(kHelloBytes), expected);
+        EXPECT_EQ(Hash::hash(std::vector<std::byte>(kHelloBytes.begin(), kHelloBytes.end())), expected);
+        EXPECT_EQ(Hash::hash(std::vector<char>{'h', 'e', 'l', 'l', 'o'}), expected);
+        EXPECT_EQ(Hash::hash(std::array<std::uint8_t, 5>{'h', 'e', 'l', 'l', 'o'}), expected);
+        EXPECT_EQ(Hash()(std::vector<char>{'h', 'e', 'l', 'l', 'o'}), expected);
+
+        // null terminated strings of any character type
+        const std::array<std::byte, 6> terminated = {std::byte{'h'}, std::byte{'e'}, std::byte{'l'}, std::byte{'l'}, std::byte{'o'}, std::byte{0}};
+        EXPECT_EQ(Hash::hash(terminated.data()), expected);
+        EXPECT_EQ(Hash::hash(u"hello"), Hash::hash(std::u16string_view(u"hello")));
+        EXPECT_EQ(Hash::hash(U"hello"), Hash::hash(std::u32string(U"hello")));
+
+        // objects are hashed as their bytes
+        EXPECT_EQ(Hash::hash_object(kRecord), Hash::hash(std::span(kRecordBytes)));
+        EXPECT_EQ(Hash::hash_object(0x6c6c6568U), Hash::hash("hell"));
+
+        const std::array<Record, 2> records = {kRecord, kRecord};
+        std::vector<std::uint8_t> bytes(kRecordBytes.begin(), kRecordBytes.end());
+        bytes.insert(bytes.end(), kRecordBytes.begin(), kRecordBytes.end());
+        EXPECT_EQ(Hash::hash_objects(records), Hash::hash(std::span(bytes)));
+        EXPECT_EQ(Hash::hash_objects(std::vector<Record>(records.begin(), records.end())), Hash::hash(std::span(bytes)));
+
+        // streaming
+        if constexpr (requires { typename Hash::State; }) {
+            EXPECT_EQ(typename Hash::Hasher().update(u8"hell").update(std::vector<char>{'o'}).finalize(), expected);
+            EXPECT_EQ(typename Hash::Hasher().update_object(kRecord).finalize(), Hash::hash_object(kRecord));
+        }
+    }
+} // namespace
+
+/// Ensure compile-time hashing of the new inputs works
+static_assert(hashes::Fnv1a_32::hash(u8"hello") == "hello"_fnv1a_32);
+static_assert(hashes::Murmur3_32::hash(kHelloBytes) == "hello"_murmur3_32);
+static_assert(hashes::Crcb_32::hash(std::span(kHelloBytes)) == "hello"_crcb_32);
+static_assert(hashes::Xxh3_64::hash(kHelloBytes) == "hello"_xxh3_64);
+static_assert(hashes::Murmur3_32::hash_object(kRecord) == hashes::Murmur3_32::hash(std::span(kRecordBytes)));
+static_assert(hashes::Fnv1a_64::hash_objects(std::array{kRecord, kRecord}) == hashes::Fnv1a_64::Hasher().update_object(kRecord).update_object(kRecord).finalize());
+
+TEST(inputs, fnv) {
+    test_inputs<hashes::Fnv1_32>();
+    test_inputs<hashes::Fnv1a_64>();
+
+    // fnv hashes characters, wide characters are hashed as their values
+    EXPECT_EQ(hashes::Fnv1a_32::hash(u"hello"), "hello"_fnv1a_32);
+    EXPECT_EQ(hashes::Fnv1a_32::hash(U"hello"), "hello"_fnv1a_32);
+}
+
+TEST(inputs, crc) {
+    test_inputs<hashes::Crcb_32>();
+    test_inputs<hashes::Crc32c>();
+}
+
+TEST(inputs, murmur) {
+    test_inputs<hashes::Murmur3_32>();
+    test_inputs<hashes::Murmur3_128>();
+
+    // murmur hashes bytes, so utf-32 strings are hashed as the bytes of their characters
+    EXPECT_EQ(hashes::Murmur3_32::hash(U"hello"), hashes::Murmur3_32::hash_objects(std::u32string_view(U"hello")));
+}
+
+TEST(inputs, xxhash) {
+    test_inputs<hashes::Xxh3_64>();
+    EXPECT_EQ(hashes::Xxh3_64::hash(u"hello"), hashes::Xxh3_64::hash_objects(std::u16string_view(u"hello")));
+}
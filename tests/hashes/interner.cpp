@@ -0,0 +1,79 @@
+#include "es3n1n/common/hashes/interner.hpp"
+#include "es3n1n/common/hashes/murmur.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(interner, basics) {
+    hashes::Interner interner;
+    EXPECT_EQ(interner.size(), 0);
+    EXPECT_FALSE(interner.find("kernel32.dll").has_value());
+
+    const auto kernel32 = interner.intern("kernel32.dll");
+    const auto ntdll = interner.intern("ntdll.dll");
+    const auto empty = interner.intern("");
+    EXPECT_NE(kernel32, ntdll);
+    EXPECT_NE(kernel32, empty);
+
+    // equal strings share the handle, no matter where they're coming from
+    EXPECT_EQ(interner.intern(std::string("kernel32.dll")), kernel32);
+    EXPECT_EQ(interner.find("ntdll.dll"), ntdll);
+    EXPECT_EQ(interner.size(), 3);
+
+    EXPECT_EQ(interner.view(kernel32), "kernel32.dll");
+    EXPECT_EQ(interner.view(empty), "");
+    EXPECT_EQ(interner.view(ntdll).data()[interner.view(ntdll).size()], '\0');
+}
+
+TEST(interner, stable_views) {
+    hashes::Interner<hashes::Murmur3_32> interner;
+    const auto first = interner.intern("first");
+    const auto first_view = interner.view(first);
+
+    // enough strings to fill several chunks and grow the index a few times, with a few large ones in between
+    std::vector<hashes::InternedString> handles;
+    for (std::size_t i = 0; i < 20000; ++i) {
+        handles.emplace_back(interner.intern(i % 1000 == 0 ? std::string(40000, static_cast<char>('a' + i % 26)) : "symbol_" + std::to_string(i)));
+    }
+
+    EXPECT_EQ(interner.view(first).data(), first_view.data());
+    EXPECT_EQ(first_view, "first");
+    for (std::size_t i = 0; i < handles.size(); ++i) {
+        if (i % 1000 == 0) {
+            EXPECT_EQ(interner.view(handles[i]), std::string(40000, static_cast<char>('a' + i % 26)));
+        } else {
+            EXPECT_EQ(interner.view(handles[i]), "symbol_" + std::to_string(i));
+        }
+        EXPECT_EQ(interner.find(interner.view(handles[i])), handles[i]);
+    }
+}
+
+TEST(interner, threads) {
+    constexpr std::size_t kThreads = 4;
+    constexpr std::size_t kStrings = 5000;
+
+    hashes::Interner interner;
+    std::vector<std::vector<hashes::InternedString>> handles(kThreads);
+    {
+        std::vector<std::jthread> threads;
+        for (std::size_t t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&interner, &result = handles[t], t]() -> void {
+                // every thread interns the same strings in a different order
+                for (std::size_t i = 0; i < kStrings; ++i) {
+                    const auto index = (i * (t * 2 + 1)) % kStrings;
+                    result.emplace_back(interner.intern("module_" + std::to_string(index)));
+                }
+            });
+        }
+    }
+
+    EXPECT_EQ(interner.size(), kStrings);
+    for (std::size_t t = 0; t < kThreads; ++t) {
+        for (std::size_t i = 0; i < kStrings; ++i) {
+            const auto index = (i * (t * 2 + 1)) % kStrings;
+            EXPECT_EQ(interner.view(handles[t][i]), "module_" + std::to_string(index));
+            EXPECT_EQ(interner.find("module_" + std::to_string(index)), handles[t][i]);
+        }
+    }
+}
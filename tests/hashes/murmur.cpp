@@ -29,9 +29,51 @@ TEST(murmur, murmur3_32) {
               !kWideCharsIsLong ? 0xaeb1e6d9 : 0x97a66461);
     // unicode characters
     EXPECT_EQ(hashes::Murmur3_32::hash(L"Hi あいうえお"), !kWideCharsIsLong ? 0x35cabd5 : 0x76d77ff1);
+    // non-ascii bytes in the tail must not be sign-extended
+    EXPECT_EQ(hashes::Murmur3_32::hash("\xff"), 0xfd6cf10d);
+    EXPECT_EQ(hashes::Murmur3_32::hash("ab\xe9"), 0x28931b53);
     // empty string
     EXPECT_EQ(hashes::Murmur3_32::hash(""), 0);
     EXPECT_EQ(hashes::Murmur3_32::hash("\0"), 0);
     EXPECT_EQ(hashes::Murmur3_32::hash(L""), 0);
     EXPECT_EQ(hashes::Murmur3_32::hash(L"\0"), 0);
 }
+
+/// Ensure compile-time hashing works
+static_assert("hello"_murmur3_128 == hashes::Hash128{.low = 0xcbd8a7b341bd9b02, .high = 0x5b1e906a48ae1d19});
+static_assert("hello"_murmur3_64 == 0xcbd8a7b341bd9b02);
+
+TEST(murmur, murmur3_128) {
+    constexpr auto kWideCharsIsLong = sizeof(wchar_t) == 4;
+    using hashes::Hash128;
+
+    EXPECT_EQ(hashes::Murmur3_128::hash("hello"), (Hash128{.low = 0xcbd8a7b341bd9b02, .high = 0x5b1e906a48ae1d19}));
+    EXPECT_EQ(hashes::Murmur3_128::hash("The quick brown fox jumps over the lazy dog"),
+              (Hash128{.low = 0xe34bbc7bbc071b6c, .high = 0x7a433ca9c49a9347}));
+    // shorter than 8 bytes
+    EXPECT_EQ(hashes::Murmur3_128::hash("ab"), (Hash128{.low = 0x938b11ea16ed1b2e, .high = 0xe65ea7019b52d4ad}));
+    // exactly 16 bytes
+    EXPECT_EQ(hashes::Murmur3_128::hash("abcdefghijklmnop"), (Hash128{.low = 0xc4ca3ca3224cb723, .high = 0x4333d695b331eb1a}));
+    // longer than 16 bytes with a tail in both halves
+    EXPECT_EQ(hashes::Murmur3_128::hash("abcdefghijklmnopqrstuvw"), (Hash128{.low = 0x40480aba9d4f238e, .high = 0x83beb7eb1c54e9ff}));
+    // long strings with multiple blocks
+    EXPECT_EQ(hashes::Murmur3_128::hash("This is a long string to test multiple blocks in the Murmur3 hash function implementation."),
+              (Hash128{.low = 0x629d0d0514ab682a, .high = 0xc99ab3465184f79d}));
+    // non-ascii bytes
+    EXPECT_EQ(hashes::Murmur3_128::hash("\xff\xff\xff\xff\xff\xff\xff\xff\xff"), (Hash128{.low = 0xaf8b4e33fb206352, .high = 0x73fdb0383892c275}));
+    // empty string
+    EXPECT_EQ(hashes::Murmur3_128::hash(""), Hash128{});
+
+    if constexpr (kWideCharsIsLong) {
+        EXPECT_EQ(hashes::Murmur3_128::hash(L"hello"), (Hash128{.low = 0x203bc5e982bb0d74, .high = 0x391e161b754492ba}));
+    }
+
+    using Seeded = hashes::Murmur3x64<Hash128, 0x1234>;
+    EXPECT_EQ(Seeded::hash("hello"), (Hash128{.low = 0x8cc386383abd5d18, .high = 0xd1c600282cf364cb}));
+}
+
+TEST(murmur, murmur3_64) {
+    EXPECT_EQ("hello"_murmur3_64, 0xcbd8a7b341bd9b02);
+    EXPECT_EQ(hashes::Murmur3_64::hash("hello"), 0xcbd8a7b341bd9b02);
+    EXPECT_EQ(hashes::Murmur3_64::hash("abcdefghijklmnopqrstuvw"), 0x40480aba9d4f238e);
+}
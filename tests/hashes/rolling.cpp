@@ -0,0 +1,97 @@
+#include "es3n1n/common/hashes/rolling.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string_view>
+#include <vector>
+
+namespace {
+    constexpr std::string_view kText = "the quick brown fox jumps over the lazy dog, the quick brown fox jumps over the lazy cat";
+
+    template <typename Hash>
+    void test_windows(const std::size_t window) {
+        const Hash hash(window);
+        const auto data = std::span(kText.data(), kText.size());
+
+        std::vector<typename Hash::ValueTy> hashes(data.size());
+        const auto count = hash.hash_windows(data, std::span(hashes));
+        ASSERT_EQ(count, data.size() - window + 1);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(hashes[i], hash.hash(data.subspan(i, window))) << i;
+        }
+
+        // Equal windows have equal hashes
+        const auto first = kText.find("the quick brown fox");
+        const auto second = kText.rfind("the quick brown fox");
+        if (window <= 19) {
+            EXPECT_EQ(hashes[first], hashes[second]);
+        }
+
+        // Shorter data has no windows
+        EXPECT_EQ(hash.hash_windows(data.first(window - 1), std::span(hashes)), 0);
+    }
+
+    /// Find every occurrence of the needle by comparing the window hashes first
+    template <typename Hash>
+    std::vector<std::size_t> find_all(const std::string_view haystack, const std::string_view needle) {
+        const Hash hash(needle.size());
+        const auto needle_hash = hash.hash(std::span(needle.data(), needle.size()));
+
+        std::vector<std::size_t> result;
+        hash.for_each_window(std::span(haystack.data(), haystack.size()), [&](const std::size_t offset, const auto window_hash) -> void {
+            if (window_hash == needle_hash && haystack.substr(offset, needle.size()) == needle) {
+                result.emplace_back(offset);
+            }
+        });
+        return result;
+    }
+} // namespace
+
+/// Ensure compile-time hashing works
+static_assert([]() -> bool {
+    constexpr std::string_view kData = "abcabc";
+    const hashes::RabinKarp<> rabin_karp(3);
+    const hashes::Buzhash<> buzhash(3);
+
+    std::array<std::uint64_t, 4> rabin_karp_windows = {};
+    std::array<std::uint64_t, 4> buzhash_windows = {};
+    rabin_karp.hash_windows(std::span(kData.data(), kData.size()), std::span(rabin_karp_windows));
+    buzhash.hash_windows(std::span(kData.data(), kData.size()), std::span(buzhash_windows));
+    return rabin_karp_windows[0] == rabin_karp_windows[3] && buzhash_windows[0] == buzhash_windows[3] && rabin_karp_windows[0] != rabin_karp_windows[1];
+}());
+static_assert(hashes::RabinKarp<std::uint32_t, 31>(2).hash(std::span("ab", 2)) == 'a' * 31 + 'b');
+
+TEST(rolling, rabin_karp) {
+    for (const std::size_t window : {1, 2, 7, 19, 64}) {
+        test_windows<hashes::RabinKarp<>>(window);
+        test_windows<hashes::RabinKarp<std::uint32_t>>(window);
+    }
+}
+
+TEST(rolling, buzhash) {
+    // windows that are multiples of the bit width are special, the outgoing byte is not rotated at all
+    for (const std::size_t window : {1, 2, 7, 19, 32, 64}) {
+        test_windows<hashes::Buzhash<>>(window);
+        test_windows<hashes::Buzhash<std::uint32_t>>(window);
+    }
+}
+
+TEST(rolling, substring_search) {
+    const std::vector<std::size_t> expected = {0, 45};
+    EXPECT_EQ(find_all<hashes::RabinKarp<>>(kText, "the quick"), expected);
+    EXPECT_EQ(find_all<hashes::Buzhash<>>(kText, "the quick"), expected);
+    EXPECT_EQ(find_all<hashes::RabinKarp<>>(kText, "lazy cat"), std::vector<std::size_t>{kText.size() - 8});
+    EXPECT_TRUE(find_all<hashes::Buzhash<>>(kText, "lazy bird").empty());
+}
+
+TEST(rolling, bytes) {
+    std::vector<std::byte> data(300);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<std::byte>(i * 13);
+    }
+
+    const hashes::Buzhash<> buzhash(48);
+    std::vector<std::uint64_t> windows(data.size());
+    buzhash.hash_windows(std::span(data), std::span(windows));
+    EXPECT_EQ(windows[100], buzhash.hash(std::span(data).subspan(100, 48)));
+}
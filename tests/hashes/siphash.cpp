@@ -0,0 +1,82 @@
+#include "es3n1n/common/hashes/siphash.hpp"
+#include <gtest/gtest.h>
+#include <unordered_set>
+
+namespace {
+    constexpr auto kInput = []() -> std::array<std::uint8_t, 64> {
+        std::array<std::uint8_t, 64> result = {};
+        for (std::size_t i = 0; i < result.size(); ++i) {
+            result.at(i) = static_cast<std::uint8_t>(i);
+        }
+        return result;
+    }();
+
+    struct TestVector {
+        std::size_t size;
+        std::uint64_t hash;
+    };
+
+    /// Reference vectors of the paper, key is 00 01 .. 0f
+    constexpr hashes::SipHashKey kReferenceKey = {.k0 = 0x0706050403020100ULL, .k1 = 0x0f0e0d0c0b0a0908ULL};
+    constexpr std::array kSipHash24Vectors = {
+        TestVector{0, 0x726fdb47dd0e0e31ULL}, TestVector{1, 0x74f839c593dc67fdULL},  TestVector{2, 0x0d6c8009d9a94f5aULL},
+        TestVector{3, 0x85676696d7fb7e2dULL}, TestVector{4, 0xcf2794e0277187b7ULL},  TestVector{5, 0x18765564cd99a68dULL},
+        TestVector{6, 0xcbc9466e58fee3ceULL}, TestVector{7, 0xab0200f58b01d137ULL},  TestVector{8, 0x93f5f5799a932462ULL},
+        TestVector{15, 0xa129ca6149be45e5ULL}, TestVector{63, 0x958a324ceb064572ULL},
+    };
+
+    /// Generated with CPython (PYTHONHASHSEED=0 sets a zero key), `hash(bytes(range(size)))`
+    constexpr std::array kSipHash13Vectors = {
+        TestVector{1, 0x68a914128e01e473ULL},  TestVector{2, 0x010bac45c41e3669ULL},  TestVector{3, 0x4d4c9a4a8ef6e0adULL},
+        TestVector{7, 0x2f098ab0c751325aULL},  TestVector{8, 0xead411e67ebe2eeaULL},  TestVector{9, 0x75927f9d95124362ULL},
+        TestVector{15, 0xf30eb725bb91c9eaULL}, TestVector{16, 0x8972188433a5c5b7ULL}, TestVector{17, 0x4883c49a2c009c1dULL},
+        TestVector{63, 0x385d3e39e5f37359ULL}, TestVector{64, 0x75e05fd5bbc870c6ULL},
+    };
+} // namespace
+
+/// Ensure compile-time hashing works
+static_assert(hashes::SipHash24(kReferenceKey).hash(std::span(kInput.data(), 15)) == 0xa129ca6149be45e5ULL);
+static_assert(hashes::SipHash13(hashes::SipHashKey{}).hash("hello") == 0xe2e77b41cb4e1f9eULL);
+
+TEST(siphash, reference_vectors) {
+    const hashes::SipHash24 siphash24(kReferenceKey);
+    for (const auto& [size, hash] : kSipHash24Vectors) {
+        EXPECT_EQ(siphash24.hash(std::span(kInput.data(), size)), hash) << size;
+    }
+
+    const hashes::SipHash13 siphash13(hashes::SipHashKey{});
+    for (const auto& [size, hash] : kSipHash13Vectors) {
+        EXPECT_EQ(siphash13.hash(std::span(kInput.data(), size)), hash) << size;
+    }
+    EXPECT_EQ(siphash13.hash("hello"), 0xe2e77b41cb4e1f9eULL);
+    EXPECT_EQ(siphash13(std::string("hello")), 0xe2e77b41cb4e1f9eULL);
+    EXPECT_EQ(siphash13(std::string_view("hello")), 0xe2e77b41cb4e1f9eULL);
+    EXPECT_EQ(siphash13(std::vector<char>{'h', 'e', 'l', 'l', 'o'}), 0xe2e77b41cb4e1f9eULL);
+}
+
+TEST(siphash, wide_chars) {
+    const hashes::SipHash13 siphash13(kReferenceKey);
+    EXPECT_EQ(siphash13.hash(u"hello"), siphash13.hash(std::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t*>(u"hello"), 10)));
+}
+
+TEST(siphash, keys) {
+    const hashes::SipHash13 first(kReferenceKey);
+    const hashes::SipHash13 second({.k0 = kReferenceKey.k0, .k1 = kReferenceKey.k1 ^ 1});
+    EXPECT_NE(first.hash("hello"), second.hash("hello"));
+
+    // Random keys
+    const hashes::SipHash13 random_first;
+    const hashes::SipHash13 random_second;
+    EXPECT_NE(random_first.key(), random_second.key());
+    EXPECT_EQ(random_first.hash("hello"), hashes::SipHash13(random_first.key()).hash("hello"));
+}
+
+TEST(siphash, unordered_set) {
+    std::unordered_set<std::string_view, hashes::SipHash13> set;
+    set.insert("foo");
+    set.insert("bar");
+    set.insert("foo");
+    EXPECT_EQ(set.size(), 2);
+    EXPECT_TRUE(set.contains("bar"));
+    EXPECT_FALSE(set.contains("baz"));
+}
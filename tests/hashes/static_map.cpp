@@ -0,0 +1,88 @@
+#include "es3n1n/common/hashes/fnv.hpp"
+#include "es3n1n/common/hashes/murmur.hpp"
+#include "es3n1n/common/hashes/static_map.hpp"
+#include <gtest/gtest.h>
+#include <string>
+
+namespace {
+    enum class Opcode : std::uint8_t {
+        Add,
+        Sub,
+        Mul,
+        Div,
+        Mov,
+        Jmp,
+        Call,
+        Ret,
+    };
+
+    constexpr auto kOpcodes = hashes::make_static_map<hashes::Fnv1a_32, Opcode>({
+        {"add", Opcode::Add},
+        {"sub", Opcode::Sub},
+        {"mul", Opcode::Mul},
+        {"div", Opcode::Div},
+        {"mov", Opcode::Mov},
+        {"jmp", Opcode::Jmp},
+        {"call", Opcode::Call},
+        {"ret", Opcode::Ret},
+    });
+
+    /// \brief "key0".."key299", kept in static storage so that the map can refer to them
+    constexpr std::size_t kManyKeys = 300;
+    constexpr auto kKeyStorage = []() -> std::array<std::array<char, 8>, kManyKeys> {
+        std::array<std::array<char, 8>, kManyKeys> result = {};
+        for (std::size_t i = 0; i < kManyKeys; ++i) {
+            auto& key = result[i];
+            key = {'k', 'e', 'y', static_cast<char>('0' + i / 100), static_cast<char>('0' + i / 10 % 10), static_cast<char>('0' + i % 10)};
+        }
+        return result;
+    }();
+
+    constexpr auto kManyEntries = []() -> std::array<std::pair<std::string_view, std::size_t>, kManyKeys> {
+        std::array<std::pair<std::string_view, std::size_t>, kManyKeys> result = {};
+        for (std::size_t i = 0; i < kManyKeys; ++i) {
+            result[i] = {std::string_view(kKeyStorage[i].data(), 6), i};
+        }
+        return result;
+    }();
+    constexpr auto kMany = hashes::StaticMap<hashes::Murmur3_32, std::size_t, kManyKeys>(kManyEntries);
+} // namespace
+
+/// Ensure compile-time lookups work
+static_assert(kOpcodes.at<"call">() == Opcode::Call);
+static_assert(kOpcodes.at("ret") == Opcode::Ret);
+static_assert(*kOpcodes.find("mov") == Opcode::Mov);
+static_assert(kOpcodes.find("nop") == nullptr);
+static_assert(*kOpcodes.find_by_hash("jmp"_fnv1a_32) == Opcode::Jmp);
+static_assert(kMany.at<"key123">() == 123);
+
+/// No heap and a table that fits the keys
+static_assert(std::is_trivially_destructible_v<decltype(kOpcodes)>);
+static_assert(decltype(kOpcodes)::kSlots == 8);
+
+TEST(static_map, lookup) {
+    EXPECT_EQ(kOpcodes.size(), 8);
+    EXPECT_EQ(kOpcodes.at("add"), Opcode::Add);
+    EXPECT_EQ(kOpcodes.at(std::string("sub")), Opcode::Sub);
+    EXPECT_EQ(kOpcodes.at<"div">(), Opcode::Div);
+    EXPECT_TRUE(kOpcodes.contains("mul"));
+
+    // missing keys, including ones that land on the free slots
+    EXPECT_FALSE(kOpcodes.contains(""));
+    EXPECT_FALSE(kOpcodes.contains("ad"));
+    EXPECT_FALSE(kOpcodes.contains("addd"));
+    EXPECT_FALSE(kOpcodes.contains("ADD"));
+    EXPECT_THROW((void)kOpcodes.at("nop"), std::out_of_range);
+    EXPECT_EQ(kOpcodes.find_by_hash("nop"_fnv1a_32), nullptr);
+}
+
+TEST(static_map, many_keys) {
+    for (std::size_t i = 0; i < kManyKeys; ++i) {
+        const auto key = kManyEntries[i].first;
+        ASSERT_NE(kMany.find(key), nullptr) << key;
+        EXPECT_EQ(*kMany.find(key), i);
+        EXPECT_FALSE(kMany.contains(std::string(key) + "x"));
+    }
+    EXPECT_FALSE(kMany.contains("key300"));
+    EXPECT_FALSE(kMany.contains("key"));
+}
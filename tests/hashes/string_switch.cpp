@@ -0,0 +1,79 @@
+#include "es3n1n/common/hashes/fnv.hpp"
+#include "es3n1n/common/hashes/murmur.hpp"
+#include "es3n1n/common/hashes/string_switch.hpp"
+#include <gtest/gtest.h>
+#include <string>
+
+namespace {
+    /// \brief A deliberately weak hash, strings of the same length collide
+    class LengthHash : public hashes::HashFunction<LengthHash, std::uint32_t> {
+    public:
+        template <hashes::detail::Hashable CharTy>
+        [[nodiscard]] static constexpr std::uint32_t hash_impl(const std::span<CharTy> value) noexcept {
+            return static_cast<std::uint32_t>(value.size());
+        }
+    };
+
+    using Command = hashes::StringSwitch<hashes::Fnv1a_32, "help", "quit", "load", "save">;
+
+    constexpr int dispatch(const std::string_view input) {
+        switch (Command::match(input)) {
+        case Command::label<"help">:
+            return 1;
+        case Command::label<"quit">:
+            return 2;
+        // Raw literals work as well, but unlike `label<>` they aren't checked against the labels
+        case "load"_fnv1a_32:
+            return 3;
+        case "save"_fnv1a_32:
+            return 4;
+        default:
+            return 0;
+        }
+    }
+} // namespace
+
+/// Ensure compile-time dispatch works
+static_assert(dispatch("help") == 1);
+static_assert(dispatch("quit") == 2);
+static_assert(dispatch("load") == 3);
+static_assert(dispatch("save") == 4);
+static_assert(dispatch("nope") == 0);
+static_assert(dispatch("") == 0);
+static_assert(Command::size() == 4);
+static_assert(Command::label<"quit"> == "quit"_fnv1a_32);
+static_assert(Command::match("quit") == "quit"_fnv1a_32);
+
+/// `label<>` only accepts the labels, while a misspelled literal is a valid case that never matches
+template <typename Switch, types::CtString Label>
+concept HasCase = requires { Switch::template label<Label>; };
+static_assert(HasCase<Command, "load">);
+static_assert(!HasCase<Command, "lod">);
+static_assert(Command::has_label<"load"> && !Command::has_label<"lod">);
+static_assert(Command::match("lod") == Command::kNoMatch && "lod"_fnv1a_32 != Command::kNoMatch);
+
+/// The no-match value never collides with a label
+static_assert(hashes::StringSwitch<LengthHash, "", "a", "bb">::kNoMatch == 3);
+
+TEST(string_switch, dispatch) {
+    EXPECT_EQ(dispatch(std::string("help")), 1);
+    EXPECT_EQ(dispatch(std::string("save")), 4);
+    EXPECT_EQ(dispatch(std::string("help ")), 0);
+    EXPECT_EQ(dispatch(std::string("HELP")), 0);
+    EXPECT_EQ(Command::match("unknown"), Command::kNoMatch);
+}
+
+TEST(string_switch, verification) {
+    // Strings with the same hash as a label don't match it
+    using Switch = hashes::StringSwitch<LengthHash, "foo", "quux">;
+    EXPECT_EQ(Switch::match("foo"), Switch::label<"foo">.get());
+    EXPECT_EQ(Switch::match("bar"), Switch::kNoMatch);
+    EXPECT_EQ(Switch::match("quux"), Switch::label<"quux">.get());
+    EXPECT_EQ(Switch::match("abcd"), Switch::kNoMatch);
+}
+
+TEST(string_switch, wide_hash) {
+    using Switch = hashes::StringSwitch<hashes::Murmur3_64, "alpha", "beta">;
+    EXPECT_EQ(Switch::match(std::string("beta")), "beta"_murmur3_64);
+    EXPECT_EQ(Switch::match(std::string("gamma")), Switch::kNoMatch);
+}
@@ -0,0 +1,46 @@
+#include "es3n1n/common/hashes/transparent.hpp"
+#include <gtest/gtest.h>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+    template <typename Hasher>
+    void test_lookup() {
+        std::unordered_map<std::string, int, Hasher, std::equal_to<>> map;
+        map.emplace("foo", 1);
+        map.emplace("bar", 2);
+
+        EXPECT_EQ(map.find(std::string_view{"foo"})->second, 1);
+        EXPECT_EQ(map.find("bar")->second, 2);
+        EXPECT_EQ(map.find(std::string{"bar"})->second, 2);
+        EXPECT_EQ(map.find(std::string_view{"baz"}), map.end());
+        EXPECT_TRUE(map.contains(std::string_view{"foo"}));
+        EXPECT_EQ(map.count("foo"), 1);
+    }
+} // namespace
+
+/// Ensure all key representations hash the same
+static_assert(hashes::Fnv1aHasher{}("hello") == hashes::Fnv1a_64::hash("hello"));
+static_assert(hashes::Fnv1aHasher{}(std::string_view{"hello"}) == hashes::Fnv1aHasher{}(std::string{"hello"}));
+static_assert(hashes::TransparentHasher<hashes::Fnv1a_64, wchar_t>{}(L"hello") == hashes::Fnv1a_64::hash(L"hello"));
+
+TEST(transparent, heterogeneous_lookup) {
+    test_lookup<hashes::Fnv1aHasher>();
+    test_lookup<hashes::Murmur3Hasher>();
+    test_lookup<hashes::Xxh3Hasher>();
+    test_lookup<hashes::SipHash13Hasher>();
+}
+
+TEST(transparent, keyed) {
+    const hashes::SipHash13 hash(hashes::SipHashKey{.k0 = 1, .k1 = 2});
+    const hashes::SipHash13Hasher hasher(hash);
+    EXPECT_EQ(hasher("hello"), hash.hash("hello"));
+    EXPECT_EQ(hasher(std::string{"hello"}), hash.hash("hello"));
+
+    std::unordered_set<std::string, hashes::SipHash13Hasher, std::equal_to<>> set(16, hasher);
+    set.emplace("foo");
+    EXPECT_TRUE(set.contains(std::string_view{"foo"}));
+    EXPECT_EQ(set.hash_function()("foo"), hash.hash("foo"));
+}
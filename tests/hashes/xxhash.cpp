@@ -0,0 +1,71 @@
+#include "es3n1n/common/hashes/xxhash.hpp"
+#include <gtest/gtest.h>
+
+namespace {
+    constexpr auto kInput = []() -> std::array<std::uint8_t, 4999> {
+        std::array<std::uint8_t, 4999> result = {};
+        for (std::size_t i = 0; i < result.size(); ++i) {
+            result.at(i) = static_cast<std::uint8_t>(i * 31 + 7);
+        }
+        return result;
+    }();
+
+    struct TestVector {
+        std::size_t size;
+        std::uint64_t hash;
+        std::uint64_t seeded_hash;
+    };
+
+    /// Generated with the reference XXH3_64bits/XXH3_64bits_withSeed(seed = 0x1234567890abcdef)
+    constexpr std::array kTestVectors = {
+        TestVector{0, 0x2d06800538d394c2ULL, 0xb5991a1202758c1dULL},    TestVector{1, 0x4c5cca45d0f4811fULL, 0xc9e3dfb6aa42ca8bULL},
+        TestVector{2, 0xa7e250c97710ff27ULL, 0x455ca5423d22963cULL},    TestVector{3, 0x15f7093b173d005cULL, 0xd0f4aa7fc3561081ULL},
+        TestVector{4, 0xdca012f95811b6b9ULL, 0x0f543d653ece862eULL},    TestVector{5, 0xb290cafc7b254345ULL, 0x25e17ab86970d592ULL},
+        TestVector{8, 0xdec6a9a43575982eULL, 0x46dec95ab9a938e5ULL},    TestVector{9, 0xcbe393399f17ffbdULL, 0x7e4c2f71492f47f2ULL},
+        TestVector{15, 0x545e19990471dc37ULL, 0x113e3f1537af3e64ULL},   TestVector{16, 0x7e484c18d74895d0ULL, 0xd0a19cd787afcbcaULL},
+        TestVector{17, 0x208bde5ee2bed407ULL, 0xd4558b67dc65045fULL},   TestVector{31, 0xa937652b0119ca11ULL, 0x3e5351bb80077e7dULL},
+        TestVector{32, 0x03df0ac5255d1446ULL, 0x8fd99405c004c7b2ULL},   TestVector{33, 0x199a362122d71f46ULL, 0x78fb1b779c564c88ULL},
+        TestVector{64, 0xdd30702ab46b3745ULL, 0xd21a42c8c8c244e0ULL},   TestVector{65, 0xfab36b851b94ce20ULL, 0x66f307438b42b71eULL},
+        TestVector{100, 0x8c97158042fbf926ULL, 0x2d2c11cab3459e9eULL},  TestVector{128, 0xf92b70eaa21a6288ULL, 0xc1ec0bc5b5651a4dULL},
+        TestVector{129, 0xf8f76713f2bb60faULL, 0xf3c6e3575a8555d3ULL},  TestVector{200, 0x12fdb864685f344dULL, 0x131b906312aca41cULL},
+        TestVector{240, 0xccc7375172c41f03ULL, 0xb5ac6ec6b515dfceULL},  TestVector{241, 0x0b3b630948ce4a00ULL, 0x9432d70c82dcbf64ULL},
+        TestVector{255, 0x89932170686cdd9aULL, 0xd623c13ae59b0d90ULL},  TestVector{256, 0xec85b75bafe6ca74ULL, 0x66607327719bfe35ULL},
+        TestVector{500, 0xe1e3ce93f69c5043ULL, 0x5b8ef4b02f05c56aULL},  TestVector{1000, 0x989765d0ea7a5ecdULL, 0x984c1ab85178c6c3ULL},
+        TestVector{1024, 0x23bc880ebf0d29c6ULL, 0x4fd7614059fb3d8dULL}, TestVector{1025, 0xc09fdfbc398c7d82ULL, 0x20feab25693bfd74ULL},
+        TestVector{2048, 0x19f6f9c987331373ULL, 0xee373ede04feac80ULL}, TestVector{4096, 0xa3c19f8174cde0bbULL, 0xda6f75e8a762c738ULL},
+        TestVector{4999, 0x00710881668d48ebULL, 0x60fc0ce10676b6f6ULL},
+    };
+
+    using SeededXxh3 = hashes::Xxh3<std::uint64_t, 0x1234567890abcdefULL>;
+} // namespace
+
+/// Ensure compile-time hashing works
+static_assert("hello"_xxh3_64 == 0x9555e8555c62dcfd);
+static_assert(""_xxh3_64 == 0x2d06800538d394c2);
+static_assert(hashes::Xxh3_64::hash(std::span(kInput.data(), 200)) == 0x12fdb864685f344dULL);
+static_assert(hashes::Xxh3_64::hash(std::span(kInput.data(), 1025)) == 0xc09fdfbc398c7d82ULL);
+static_assert(SeededXxh3::hash(std::span(kInput.data(), 1025)) == 0x20feab25693bfd74ULL);
+
+TEST(xxhash, xxh3_64) {
+    constexpr auto kWideCharsIsLong = sizeof(wchar_t) == 4;
+
+    EXPECT_EQ("hello"_xxh3_64, 0x9555e8555c62dcfd);
+    EXPECT_EQ(hashes::Xxh3_64::hash("hello"), 0x9555e8555c62dcfd);
+    if constexpr (kWideCharsIsLong) {
+        // hashing bytes, just like murmur3
+        EXPECT_EQ(hashes::Xxh3_64::hash(L"hello"), 0xaaad1bea66c78b42);
+    }
+
+    // long path with a string
+    EXPECT_EQ(hashes::Xxh3_64::hash("This is a long string to test multiple blocks in the xxh3 hash function implementation, it should be longer "
+                                    "than 240 bytes so that the long path is taken: lorem ipsum dolor sit amet, consectetur adipiscing elit, sed "
+                                    "do eiusmod tempor incididunt ut labore et dolore magna aliqua."),
+              0x6efebe895aa85c8f);
+}
+
+TEST(xxhash, xxh3_64_vectors) {
+    for (const auto& [size, hash, seeded_hash] : kTestVectors) {
+        EXPECT_EQ(hashes::Xxh3_64::hash(std::span(kInput.data(), size)), hash) << size;
+        EXPECT_EQ(SeededXxh3::hash(std::span(kInput.data(), size)), seeded_hash) << size;
+    }
+}
@@ -0,0 +1,175 @@
+#include <es3n1n/common/memory/address.hpp>
+#include <es3n1n/common/memory/page_cache.hpp>
+#include <gtest/gtest.h>
+#include <array>
+#include <cstring>
+#include <memory>
+
+namespace {
+    std::size_t read_calls = 0;
+    std::uintptr_t readable_end = 0;
+
+    std::expected<std::size_t, memory::ErrorCode> counting_read(void* buffer, const std::uintptr_t address, const std::size_t size) {
+        ++read_calls;
+        if (readable_end != 0 && address + size > readable_end) {
+            return std::unexpected(memory::ErrorCode::INVALID_ADDRESS);
+        }
+        return memory::default_read(buffer, address, size);
+    }
+
+    /// \brief Page aligned buffer of a few pages
+    struct Pages {
+        static constexpr std::size_t kCount = 4;
+
+        Pages() {
+            for (std::size_t i = 0; i < data.size(); ++i) {
+                data[i] = static_cast<std::uint8_t>(i * 7);
+            }
+        }
+
+        [[nodiscard]] std::uintptr_t address(const std::size_t offset) const {
+            return reinterpret_cast<std::uintptr_t>(data.data()) + offset;
+        }
+
+        alignas(COMMON_PAGE_SIZE) std::array<std::uint8_t, COMMON_PAGE_SIZE * kCount> data = {};
+    };
+} // namespace
+
+TEST(page_cache, hits_and_misses) {
+    const auto pages = std::make_unique<Pages>();
+    memory::PageCache cache(counting_read);
+    read_calls = 0;
+
+    std::uint32_t value = 0;
+    EXPECT_EQ(cache.read(&value, pages->address(0x10), sizeof(value)).value(), sizeof(value));
+    EXPECT_EQ(std::memcmp(&value, &pages->data[0x10], sizeof(value)), 0);
+    EXPECT_EQ(cache.misses(), 1U);
+    EXPECT_EQ(read_calls, 1U);
+
+    // The rest of the page is served from the cache
+    for (std::size_t offset = 0; offset < COMMON_PAGE_SIZE; offset += sizeof(value)) {
+        EXPECT_TRUE(cache.read(&value, pages->address(offset), sizeof(value)).has_value());
+    }
+    EXPECT_EQ(read_calls, 1U);
+    EXPECT_EQ(cache.hits(), COMMON_PAGE_SIZE / sizeof(value));
+
+    // Reads across the page boundary fetch both pages
+    std::array<std::uint8_t, 0x20> buffer = {};
+    EXPECT_TRUE(cache.read(buffer.data(), pages->address(COMMON_PAGE_SIZE - 0x10), buffer.size()).has_value());
+    EXPECT_EQ(std::memcmp(buffer.data(), &pages->data[COMMON_PAGE_SIZE - 0x10], buffer.size()), 0);
+    EXPECT_EQ(read_calls, 2U);
+    EXPECT_EQ(cache.size(), 2U);
+}
+
+TEST(page_cache, invalidation) {
+    const auto pages = std::make_unique<Pages>();
+    memory::PageCache cache(counting_read);
+
+    std::uint8_t value = 0;
+    EXPECT_TRUE(cache.read(&value, pages->address(0x100), 1).has_value());
+    pages->data[0x100] = 0xCC;
+
+    // Stale until invalidated
+    EXPECT_TRUE(cache.read(&value, pages->address(0x100), 1).has_value());
+    EXPECT_NE(value, 0xCC);
+
+    const auto generation = cache.generation();
+    cache.invalidate();
+    EXPECT_EQ(cache.generation(), generation + 1);
+    EXPECT_TRUE(cache.read(&value, pages->address(0x100), 1).has_value());
+    EXPECT_EQ(value, 0xCC);
+    EXPECT_EQ(cache.misses(), 2U);
+    EXPECT_EQ(cache.size(), 1U);
+
+    // Writes drop the pages they touch
+    constexpr std::uint16_t kValue = 0x1234;
+    EXPECT_TRUE(cache.write(pages->address(COMMON_PAGE_SIZE - 1), &kValue, sizeof(kValue)).has_value());
+    EXPECT_EQ(cache.size(), 0U);
+    std::uint16_t written = 0;
+    EXPECT_TRUE(cache.read(&written, pages->address(COMMON_PAGE_SIZE - 1), sizeof(written)).has_value());
+    EXPECT_EQ(written, kValue);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0U);
+    EXPECT_EQ(cache.hits(), 0U);
+    EXPECT_EQ(cache.misses(), 0U);
+}
+
+TEST(page_cache, lru_eviction) {
+    const auto pages = std::make_unique<Pages>();
+    memory::PageCache cache(counting_read, memory::default_write, 2);
+    read_calls = 0;
+
+    std::uint8_t value = 0;
+    const auto read_page = [&](const std::size_t index) -> void {
+        EXPECT_TRUE(cache.read(&value, pages->address(index * COMMON_PAGE_SIZE), 1).has_value());
+    };
+
+    read_page(0);
+    read_page(1);
+    read_page(0); // Page 1 becomes the least recently used one
+    read_page(2); // Evicts page 1
+    EXPECT_EQ(read_calls, 3U);
+    EXPECT_EQ(cache.size(), 2U);
+
+    read_page(0);
+    EXPECT_EQ(read_calls, 3U);
+    read_page(1);
+    EXPECT_EQ(read_calls, 4U);
+
+    EXPECT_THROW(memory::PageCache(memory::default_read, memory::default_write, 0), std::invalid_argument);
+}
+
+TEST(page_cache, errors) {
+    const auto pages = std::make_unique<Pages>();
+    memory::PageCache cache(counting_read);
+    std::uint8_t value = 0;
+    EXPECT_EQ(cache.read(&value, 0, 1).error(), memory::ErrorCode::INVALID_ADDRESS);
+    EXPECT_EQ(cache.read(&value, 0x1000, 0).error(), memory::ErrorCode::INVALID_PARAMETERS);
+    EXPECT_EQ(cache.misses(), 0U);
+
+    // Unreadable pages are not cached, reads that run into them are partial
+    readable_end = pages->address(COMMON_PAGE_SIZE * 2);
+    std::array<std::uint8_t, 0x20> buffer = {};
+    EXPECT_EQ(cache.read(buffer.data(), pages->address(COMMON_PAGE_SIZE * 2 - 0x10), buffer.size()).error(), memory::ErrorCode::NOT_ENOUGH_BYTES);
+    EXPECT_EQ(cache.read(buffer.data(), pages->address(COMMON_PAGE_SIZE * 2), buffer.size()).error(), memory::ErrorCode::INVALID_ADDRESS);
+    EXPECT_EQ(cache.size(), 1U);
+    readable_end = 0;
+}
+
+TEST(page_cache, reader) {
+    const auto pages = std::make_unique<Pages>();
+    memory::Reader reader;
+    reader.read_primitive(counting_read);
+    reader.read_batch_primitive(memory::default_read_batch);
+    memory::enable_page_cache(reader);
+    EXPECT_NE(reader.read_primitive(), &counting_read);
+    EXPECT_EQ(reader.read_batch_primitive(), nullptr);
+
+    // There's a single cache, it can't be enabled for another reader at the same time
+    memory::Reader other;
+    EXPECT_THROW(memory::enable_page_cache(other), std::logic_error);
+    EXPECT_THROW(memory::disable_page_cache(other), std::logic_error);
+    read_calls = 0;
+
+    EXPECT_EQ(reader.read<std::uint8_t>(pages->address(0x21)).value(), pages->data[0x21]);
+    EXPECT_EQ(reader.read<std::uint8_t>(pages->address(0x22)).value(), pages->data[0x22]);
+    EXPECT_EQ(read_calls, 1U);
+    EXPECT_EQ(memory::page_cache().hits(), 1U);
+
+    std::array<std::uint8_t, 2> values = {};
+    std::array<memory::ReadRequest, 2> requests = {{
+        {.buffer = &values[0], .address = pages->address(0x30), .size = 1},
+        {.buffer = &values[1], .address = pages->address(0x31), .size = 1},
+    }};
+    EXPECT_EQ(reader.read_batch(requests), 2U);
+    EXPECT_EQ(values[1], pages->data[0x31]);
+    EXPECT_EQ(read_calls, 1U);
+
+    // The primitives the reader had before are restored
+    memory::disable_page_cache(reader);
+    EXPECT_EQ(memory::page_cache().size(), 0U);
+    EXPECT_EQ(reader.read_primitive(), &counting_read);
+    EXPECT_EQ(reader.write_primitive(), &memory::default_write);
+    EXPECT_EQ(reader.read_batch_primitive(), &memory::default_read_batch);
+}
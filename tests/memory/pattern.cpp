@@ -0,0 +1,68 @@
+#include <es3n1n/common/memory/pattern.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(pattern, parse) {
+    const memory::Pattern pattern("48 8B ?? ? e8");
+    const auto view = pattern.view();
+    EXPECT_EQ(pattern.size(), 5U);
+    EXPECT_EQ(std::vector(view.bytes.begin(), view.bytes.end()), (std::vector<std::uint8_t>{0x48, 0x8B, 0x00, 0x00, 0xE8}));
+    EXPECT_EQ(std::vector(view.mask.begin(), view.mask.end()), (std::vector<std::uint8_t>{0xFF, 0xFF, 0x00, 0x00, 0xFF}));
+
+    // Extra spaces are fine
+    EXPECT_EQ(memory::Pattern("  CC   ?? CC ").size(), 3U);
+}
+
+TEST(pattern, anchors) {
+    // The rarest bytes are picked, wildcards are never anchors
+    const auto view = memory::Pattern("48 8B ?? ?? 5F 00 E8").view();
+    EXPECT_EQ(view.anchors.first, 4U);
+    EXPECT_EQ(view.anchors.second, 6U);
+
+    const auto single = memory::Pattern("?? ?? 7A ??").view();
+    EXPECT_EQ(single.anchors.first, 2U);
+    EXPECT_EQ(single.anchors.second, 2U);
+}
+
+TEST(pattern, matches) {
+    const memory::Pattern pattern("48 ?? E8");
+    constexpr std::array<std::uint8_t, 3> kMatching = {0x48, 0x12, 0xE8};
+    constexpr std::array<std::uint8_t, 3> kMismatching = {0x48, 0x12, 0xE9};
+    EXPECT_TRUE(pattern.view().matches(kMatching.data()));
+    EXPECT_FALSE(pattern.view().matches(kMismatching.data()));
+}
+
+TEST(pattern, malformed) {
+    EXPECT_THROW(memory::Pattern(""), std::invalid_argument);
+    EXPECT_THROW(memory::Pattern("   "), std::invalid_argument);
+    EXPECT_THROW(memory::Pattern("?? ??"), std::invalid_argument);
+    EXPECT_THROW(memory::Pattern("4"), std::invalid_argument);
+    EXPECT_THROW(memory::Pattern("48 8G"), std::invalid_argument);
+    EXPECT_THROW(memory::Pattern("488B"), std::invalid_argument);
+    EXPECT_THROW(memory::Pattern("48 ???"), std::invalid_argument);
+}
+
+namespace {
+    using Signature = memory::CtPattern<"48 8B ?? ?? 5F 00 E8">;
+} // namespace
+
+/// Ensure patterns are compiled at compile time
+static_assert(Signature::size() == 7);
+static_assert(Signature::kBytes == std::array<std::uint8_t, 7>{0x48, 0x8B, 0x00, 0x00, 0x5F, 0x00, 0xE8});
+static_assert(Signature::kMask == std::array<std::uint8_t, 7>{0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF});
+static_assert(Signature::kAnchors.first == 4 && Signature::kAnchors.second == 6);
+static_assert(Signature::matches(std::array<std::uint8_t, 7>{0x48, 0x8B, 0x12, 0x34, 0x5F, 0x00, 0xE8}.data()));
+static_assert(!Signature::matches(std::array<std::uint8_t, 7>{0x48, 0x8B, 0x12, 0x34, 0x5F, 0x01, 0xE8}.data()));
+static_assert(decltype("?? cc"_pattern)::kAnchors.first == 1);
+static_assert(decltype("?? cc"_pattern)::view().size() == 2);
+
+TEST(pattern, compile_time) {
+    // Compiled patterns are equal to the ones parsed at runtime
+    const memory::Pattern runtime("48 8B ?? ?? 5F 00 E8");
+    const auto view = runtime.view();
+    const auto ct_view = Signature::view();
+    EXPECT_TRUE(std::ranges::equal(view.bytes, ct_view.bytes));
+    EXPECT_TRUE(std::ranges::equal(view.mask, ct_view.mask));
+    EXPECT_EQ(view.anchors.first, ct_view.anchors.first);
+    EXPECT_EQ(view.anchors.second, ct_view.anchors.second);
+}
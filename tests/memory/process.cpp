@@ -0,0 +1,128 @@
+#include <es3n1n/common/memory/page_cache.hpp>
+#include <es3n1n/common/memory/process.hpp>
+#include <gtest/gtest.h>
+
+#if PLATFORM_IS_LINUX
+    #include <algorithm>
+    #include <array>
+    #include <csignal>
+    #include <sys/mman.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+
+namespace {
+    constexpr std::size_t kPageSize = 0x1000;
+
+    /// \brief Forks a child that sleeps until it's killed, the child gets a copy of the parent memory
+    class process_memory : public testing::Test {
+    protected:
+        void SetUp() override {
+            // Two pages, the second one is unmapped to test partial reads
+            auto* mapping = mmap(nullptr, kPageSize * 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            ASSERT_NE(mapping, MAP_FAILED);
+            munmap(static_cast<std::uint8_t*>(mapping) + kPageSize, kPageSize);
+            page_ = static_cast<std::uint8_t*>(mapping);
+            for (std::size_t i = 0; i < kPageSize; ++i) {
+                page_[i] = static_cast<std::uint8_t>(i);
+            }
+
+            child_ = fork();
+            ASSERT_GE(child_, 0);
+            if (child_ == 0) {
+                pause();
+                _exit(0);
+            }
+
+            // Diverge from the child, reads should return the child values
+            std::fill_n(page_, kPageSize, std::uint8_t{0});
+            memory::process::attach(child_);
+        }
+
+        void TearDown() override {
+            memory::process::detach();
+            if (child_ > 0) {
+                kill(child_, SIGKILL);
+                waitpid(child_, nullptr, 0);
+            }
+            if (page_ != nullptr) {
+                munmap(page_, kPageSize);
+            }
+        }
+
+        [[nodiscard]] std::uintptr_t address(const std::size_t offset) const {
+            return reinterpret_cast<std::uintptr_t>(page_) + offset;
+        }
+
+        memory::Reader& reader_ = memory::reader;
+        std::uint8_t* page_ = nullptr;
+        pid_t child_ = -1;
+    };
+} // namespace
+
+TEST_F(process_memory, read_write) {
+    EXPECT_EQ(memory::process::target(), child_);
+    EXPECT_EQ(reader_.read<std::uint8_t>(address(0x42)).value(), 0x42);
+    EXPECT_EQ(reader_.read<std::uint32_t>(address(0x10)).value(), 0x13121110U);
+
+    constexpr std::uint16_t kValue = 0xBBAA;
+    EXPECT_EQ(reader_.write(&kValue, address(0x100)).value(), sizeof(kValue));
+    EXPECT_EQ(reader_.read<std::uint16_t>(address(0x100)).value(), kValue);
+    EXPECT_EQ(page_[0x100], 0U);
+}
+
+TEST_F(process_memory, errors) {
+    std::array<std::uint8_t, 0x20> buffer = {};
+    EXPECT_EQ(reader_.read(buffer.data(), address(kPageSize - 0x10), buffer.size()).error(), memory::ErrorCode::NOT_ENOUGH_BYTES);
+    EXPECT_EQ(buffer[0], 0xF0);
+    EXPECT_EQ(reader_.read(buffer.data(), address(kPageSize), buffer.size()).error(), memory::ErrorCode::INVALID_ADDRESS);
+    EXPECT_EQ(reader_.read(buffer.data(), 0, buffer.size()).error(), memory::ErrorCode::INVALID_ADDRESS);
+    EXPECT_EQ(reader_.read(buffer.data(), address(0), 0).error(), memory::ErrorCode::INVALID_PARAMETERS);
+    EXPECT_EQ(reader_.write(address(kPageSize), buffer.data(), buffer.size()).error(), memory::ErrorCode::INVALID_ADDRESS);
+}
+
+TEST_F(process_memory, read_batch) {
+    std::array<std::uint8_t, 4> first = {};
+    std::array<std::uint8_t, 0x20> partial = {};
+    std::array<std::uint8_t, 4> unmapped = {};
+    std::array<std::uint8_t, 4> last = {};
+
+    std::array<memory::ReadRequest, 5> requests = {{
+        {.buffer = first.data(), .address = address(0x20), .size = first.size()},
+        {.buffer = partial.data(), .address = address(kPageSize - 0x10), .size = partial.size()},
+        {.buffer = unmapped.data(), .address = address(kPageSize + 0x10), .size = unmapped.size()},
+        {.buffer = nullptr, .address = address(0), .size = 4},
+        {.buffer = last.data(), .address = address(0x80), .size = last.size()},
+    }};
+    EXPECT_EQ(reader_.read_batch(requests), 2U);
+
+    EXPECT_EQ(requests[0].result.value(), 4U);
+    EXPECT_EQ(first, (std::array<std::uint8_t, 4>{0x20, 0x21, 0x22, 0x23}));
+    EXPECT_EQ(requests[1].result.error(), memory::ErrorCode::NOT_ENOUGH_BYTES);
+    EXPECT_EQ(requests[2].result.error(), memory::ErrorCode::INVALID_ADDRESS);
+    EXPECT_EQ(requests[3].result.error(), memory::ErrorCode::INVALID_ADDRESS);
+    EXPECT_EQ(requests[4].result.value(), 4U);
+    EXPECT_EQ(last, (std::array<std::uint8_t, 4>{0x80, 0x81, 0x82, 0x83}));
+}
+
+TEST_F(process_memory, large_batch) {
+    // More requests than a single syscall accepts
+    std::array<std::uint8_t, 3000> values = {};
+    std::array<memory::ReadRequest, 3000> requests = {};
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+        requests[i] = {.buffer = &values[i], .address = address(i % kPageSize), .size = 1};
+    }
+    EXPECT_EQ(reader_.read_batch(requests), requests.size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(values[i], static_cast<std::uint8_t>(i % kPageSize));
+    }
+}
+
+TEST_F(process_memory, page_cache) {
+    // The cache reads the attached process, and the process primitives are back once it's disabled
+    memory::enable_page_cache();
+    EXPECT_EQ(reader_.read<std::uint8_t>(address(0x42)).value(), 0x42);
+    memory::disable_page_cache();
+    EXPECT_EQ(reader_.read_batch_primitive(), &memory::process::read_batch);
+    EXPECT_EQ(reader_.read<std::uint8_t>(address(0x43)).value(), 0x43);
+}
+#endif
@@ -1,6 +1,7 @@
 #include <es3n1n/common/memory/address.hpp>
 #include <es3n1n/common/memory/reader.hpp>
 #include <gtest/gtest.h>
+#include <array>
 #include <tuple>
 
 inline std::expected<std::size_t, memory::ErrorCode> read_impl(void*, const std::uintptr_t, const std::size_t) {
@@ -21,3 +22,43 @@ TEST(reader, read_write_impls) {
     EXPECT_THROW(std::ignore = memory::address(0x1234).read<int>(), std::runtime_error);
     EXPECT_THROW(memory::address(0x1234).write<int>(0), std::runtime_error);
 }
+
+namespace {
+    std::size_t batch_calls = 0;
+
+    void read_batch_impl(const std::span<memory::ReadRequest> requests) {
+        ++batch_calls;
+        memory::default_read_batch(requests);
+    }
+} // namespace
+
+TEST(reader, read_batch) {
+    const std::uint32_t first = 0x11223344;
+    const std::uint64_t second = 0x5566778899AABBCC;
+    std::uint32_t first_out = 0;
+    std::uint64_t second_out = 0;
+    std::uint8_t unused = 0;
+
+    std::array<memory::ReadRequest, 3> requests = {{
+        {.buffer = &first_out, .address = reinterpret_cast<std::uintptr_t>(&first), .size = sizeof(first)},
+        {.buffer = &second_out, .address = reinterpret_cast<std::uintptr_t>(&second), .size = sizeof(second)},
+        {.buffer = &unused, .address = 0, .size = 1},
+    }};
+
+    // Falls back to the read primitive per request
+    memory::Reader reader;
+    EXPECT_EQ(reader.read_batch(requests), 2U);
+    EXPECT_EQ(first_out, first);
+    EXPECT_EQ(second_out, second);
+    EXPECT_EQ(requests[0].result.value(), sizeof(first));
+    EXPECT_EQ(requests[1].result.value(), sizeof(second));
+    EXPECT_EQ(requests[2].result.error(), memory::ErrorCode::INVALID_ADDRESS);
+
+    // The whole batch is passed to the batch primitive at once
+    first_out = 0;
+    reader.read_batch_primitive(read_batch_impl);
+    EXPECT_EQ(reader.read_batch(requests), 2U);
+    EXPECT_EQ(batch_calls, 1U);
+    EXPECT_EQ(first_out, first);
+    EXPECT_EQ(reader.read_batch({}), 0U);
+}
@@ -0,0 +1,122 @@
+#include <es3n1n/common/memory/scanner.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace {
+    std::vector<std::uint8_t> make_data(const std::size_t size) {
+        std::mt19937 rng(1337);
+        std::vector<std::uint8_t> result(size);
+        for (auto& byte : result) {
+            byte = static_cast<std::uint8_t>(rng() % 0x40);
+        }
+        return result;
+    }
+
+    void plant(std::vector<std::uint8_t>& data, const std::size_t offset, const std::vector<std::uint8_t>& bytes) {
+        std::ranges::copy(bytes, data.begin() + static_cast<std::ptrdiff_t>(offset));
+    }
+
+    std::vector<std::size_t> naive_scan(const std::span<const std::uint8_t> data, const memory::PatternView& pattern) {
+        std::vector<std::size_t> result;
+        for (std::size_t i = 0; i + pattern.size() <= data.size(); ++i) {
+            if (pattern.matches(data.data() + i)) {
+                result.emplace_back(i);
+            }
+        }
+        return result;
+    }
+
+    std::vector<std::size_t> offsets(memory::Scanner scanner, const std::span<const std::uint8_t> data) {
+        std::vector<std::size_t> result;
+        for (const auto match : scanner) {
+            result.emplace_back(match.inner() - reinterpret_cast<std::uintptr_t>(data.data()));
+        }
+        return result;
+    }
+} // namespace
+
+TEST(scanner, matches_naive_scan) {
+    auto data = make_data(10000);
+    const std::vector<std::uint8_t> signature = {0x48, 0x8B, 0x11, 0x22, 0xE8};
+    for (const std::size_t offset : {0U, 29U, 34U, 61U, 500U, 4093U, 9995U}) {
+        plant(data, offset, signature);
+    }
+
+    for (const auto* text : {"48 8B ?? ?? E8", "48 8B 11 22 E8", "?? 8B ?? ?? E8 ??", "E8", "22 ?? ?? ?? ?? ?? ?? ?? ?? ?? ?? ?? ?? ?? ?? ?? ?? ?? 01"}) {
+        const memory::Pattern pattern(text);
+        const auto expected = naive_scan(data, pattern);
+        EXPECT_EQ(offsets(memory::Scanner(data, pattern), data), expected) << text;
+    }
+
+    const auto found = offsets(memory::Scanner(data, memory::Pattern("48 8B ?? ?? E8")), data);
+    EXPECT_EQ(found.front(), 0U);
+    EXPECT_EQ(found.back(), 9995U);
+}
+
+#if PLATFORM_IS_X86
+TEST(scanner, vector_paths) {
+    auto data = make_data(4096);
+    plant(data, 100, {0x3F, 0x12, 0x00, 0x3F});
+    plant(data, 4092, {0x3F, 0x12, 0x00, 0x3F});
+    const memory::Pattern pattern("3F ?? 00 3F");
+    const auto view = pattern.view();
+    const auto expected = naive_scan(data, view);
+    ASSERT_FALSE(expected.empty());
+
+    // Every vector path finds the first match in its blocks
+    const auto end = data.size() - view.size() + 1;
+    std::size_t offset = 0;
+    if (cpu::features().sse2) {
+        EXPECT_EQ(memory::detail::find_pattern_sse2(data.data(), end, offset, view), expected.front());
+    }
+    if (cpu::features().avx2) {
+        offset = 0;
+        EXPECT_EQ(memory::detail::find_pattern_avx2(data.data(), end, offset, view), expected.front());
+    }
+    EXPECT_EQ(memory::detail::find_pattern(data, expected.back(), view), expected.back());
+}
+#endif
+
+TEST(scanner, buffer) {
+    auto data = make_data(1000);
+    for (const std::size_t offset : {10U, 20U, 30U, 40U}) {
+        plant(data, offset, {0xAA, 0xBB});
+    }
+
+    std::array<memory::Address, 3> matches = {};
+    EXPECT_EQ(memory::scan(data, memory::Pattern("AA BB"), matches), 3U);
+    EXPECT_EQ(matches[0], memory::Address{data.data() + 10});
+    EXPECT_EQ(matches[2], memory::Address{data.data() + 30});
+
+    // Ranges are scanned directly
+    const memory::Range range = {.start = data.data() + 15, .end = data.data() + data.size()};
+    EXPECT_EQ(memory::scan(range, memory::Pattern("AA BB"), matches), 3U);
+    EXPECT_EQ(matches[0], memory::Address{data.data() + 20});
+
+    EXPECT_EQ(memory::scan_first(range, memory::Pattern("BB")), memory::Address{data.data() + 21});
+    EXPECT_FALSE(memory::scan_first(data, memory::Pattern("FF FF FF")).has_value());
+}
+
+TEST(scanner, small_data) {
+    const std::vector<std::uint8_t> data = {0x01, 0x02, 0x03};
+    EXPECT_EQ(memory::scan_first(data, memory::Pattern("01 02 03")), memory::Address{data.data()});
+    EXPECT_FALSE(memory::scan_first(data, memory::Pattern("01 02 03 04")).has_value());
+    EXPECT_FALSE(memory::scan_first(std::span<const std::uint8_t>{}, memory::Pattern("01")).has_value());
+
+    const memory::Pattern pattern("02");
+    memory::Scanner scanner(data, pattern);
+    EXPECT_EQ(scanner.next(), memory::Address{data.data() + 1});
+    EXPECT_FALSE(scanner.next().has_value());
+    EXPECT_FALSE(scanner.next().has_value());
+}
+
+TEST(scanner, compile_time_pattern) {
+    auto data = make_data(1000);
+    plant(data, 123, {0x48, 0x8B, 0x01, 0x02, 0xE8});
+    EXPECT_EQ(memory::scan_first(data, "48 8B ?? ?? E8"_pattern), memory::Address{data.data() + 123});
+
+    std::array<memory::Address, 4> matches = {};
+    EXPECT_EQ(memory::scan(data, "8B ?? ?? E8"_pattern, matches), 1U);
+    EXPECT_EQ(matches[0], memory::Address{data.data() + 124});
+}